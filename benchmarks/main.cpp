@@ -0,0 +1,415 @@
+//--------------------------------------------------
+// ImPlot3D Benchmarks
+// main.cpp
+// Date: 2026-10-18
+// Author: Breno Cunha Queiroz (brenocq.com)
+//--------------------------------------------------
+
+// Headless benchmarks of the plot items. Each item is plotted with 1e3 to 1e7 elements (1e6 for PlotImage and PlotText, which submit one
+// item per element) under a fixed and a rotating camera. There is no rendering backend: each frame ends with ImGui::Render() and the draw
+// data is inspected. Results are written as CSV, one line per run:
+//   item,count,camera,frames,ms_per_frame,vertices,indices,bytes
+// Meshes given with --mesh are also loaded with ImPlot3D::LoadMesh() (item LoadMesh, count is the number of triangles, ms per load).
+// With --check-allocations, each item is instead plotted with 1e5 elements for a few frames and the run fails if any frame after the
+// second one allocates through the ImGui allocator (warm-up frames fill the caches and grow the buffers).
+// With --check-command-lists, two command lists recording different points are submitted on alternate frames and the run fails if a frame
+// doesn't render the points of its list.
+//
+// Usage: benchmarks [--max-count N] [--min-time SECONDS] [--item NAME] [--mesh FILE]... [--output FILE] [--check-allocations]
+//                   [--check-command-lists]
+
+#include "imgui.h"
+#include "implot3d.h"
+#include "implot3d_internal.h"
+#include "implot3d_io.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+// Data of the elements of an item
+struct BenchmarkData {
+    std::vector<float> Xs, Ys, Zs;  // Points
+    std::vector<ImPlot3DPoint> Vtx; // Mesh vertices
+    std::vector<unsigned int> Idx;  // Mesh indices
+    int XCount = 0, YCount = 0;     // Surface grid size
+};
+
+// Plot item benchmarked with an increasing number of elements
+struct BenchmarkItem {
+    const char* Name;
+    void (*Setup)(BenchmarkData& data, int count); // Generates the data of count elements
+    void (*Plot)(const BenchmarkData& data);       // Plots the elements
+    int MaxCount;                                  // Largest number of elements of the sweep (also bounded by --max-count)
+};
+
+// Deterministic random value in [-1, 1]
+static float Random(unsigned int& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return (float)(state & 0xFFFFFF) * (2.0f / 0xFFFFFF) - 1.0f;
+}
+
+static void ResizePoints(BenchmarkData& data, int count) {
+    data.Xs.resize(count);
+    data.Ys.resize(count);
+    data.Zs.resize(count);
+}
+
+// Random points in the plot box
+static void SetupPoints(BenchmarkData& data, int count) {
+    unsigned int state = 1;
+    ResizePoints(data, count);
+    for (int i = 0; i < count; i++) {
+        data.Xs[i] = Random(state);
+        data.Ys[i] = Random(state);
+        data.Zs[i] = Random(state);
+    }
+}
+
+// Curve winding around the plot box
+static void SetupLine(BenchmarkData& data, int count) {
+    ResizePoints(data, count);
+    for (int i = 0; i < count; i++) {
+        const float t = 100.0f * (float)i / count;
+        data.Xs[i] = sinf(3.0f * t);
+        data.Ys[i] = cosf(5.0f * t);
+        data.Zs[i] = sinf(7.0f * t);
+    }
+}
+
+// Small triangles (vertices = 3) or quads (vertices = 4) at random positions
+static void SetupPolygons(BenchmarkData& data, int count, int vertices) {
+    unsigned int state = 1;
+    ResizePoints(data, count * vertices);
+    for (int i = 0; i < count; i++) {
+        const float cx = Random(state), cy = Random(state), cz = Random(state);
+        const float ux = 0.02f * Random(state), uy = 0.02f * Random(state), uz = 0.02f * Random(state);
+        const float vx = 0.02f * Random(state), vy = 0.02f * Random(state), vz = 0.02f * Random(state);
+        const float su[4] = {-1.0f, 1.0f, 1.0f, -1.0f};
+        const float sv[4] = {-1.0f, -1.0f, 1.0f, 1.0f};
+        for (int k = 0; k < vertices; k++) {
+            data.Xs[i * vertices + k] = cx + su[k] * ux + sv[k] * vx;
+            data.Ys[i * vertices + k] = cy + su[k] * uy + sv[k] * vy;
+            data.Zs[i * vertices + k] = cz + su[k] * uz + sv[k] * vz;
+        }
+    }
+}
+
+static void SetupTriangles(BenchmarkData& data, int count) { SetupPolygons(data, count, 3); }
+
+static void SetupQuads(BenchmarkData& data, int count) { SetupPolygons(data, count, 4); }
+
+// Square grid of about count vertices
+static void SetupSurface(BenchmarkData& data, int count) {
+    const int n = (int)sqrt((double)count) > 2 ? (int)sqrt((double)count) : 2;
+    data.XCount = n;
+    data.YCount = n;
+    ResizePoints(data, n * n);
+    for (int y = 0; y < n; y++) {
+        for (int x = 0; x < n; x++) {
+            const int i = x + y * n;
+            data.Xs[i] = -1.0f + 2.0f * x / (n - 1);
+            data.Ys[i] = -1.0f + 2.0f * y / (n - 1);
+            data.Zs[i] = 0.5f * sinf(6.0f * data.Xs[i]) * cosf(6.0f * data.Ys[i]);
+        }
+    }
+}
+
+// Torus of about count triangles
+static void SetupMesh(BenchmarkData& data, int count) {
+    const int n = (int)sqrt(count / 2.0) > 3 ? (int)sqrt(count / 2.0) : 3;
+    data.Vtx.resize(n * n);
+    data.Idx.resize(n * n * 6);
+    for (int i = 0; i < n; i++) {
+        const float u = 6.2831853f * i / n;
+        for (int j = 0; j < n; j++) {
+            const float v = 6.2831853f * j / n;
+            data.Vtx[i * n + j] = ImPlot3DPoint((0.7f + 0.25f * cosf(v)) * cosf(u), (0.7f + 0.25f * cosf(v)) * sinf(u), 0.25f * sinf(v));
+            const unsigned int a = i * n + j, b = i * n + (j + 1) % n;
+            const unsigned int c = ((i + 1) % n) * n + j, d = ((i + 1) % n) * n + (j + 1) % n;
+            unsigned int* t = &data.Idx[(i * n + j) * 6];
+            t[0] = a, t[1] = b, t[2] = d, t[3] = a, t[4] = d, t[5] = c;
+        }
+    }
+}
+
+static void PlotScatterItem(const BenchmarkData& data) {
+    ImPlot3D::PlotScatter("Scatter", data.Xs.data(), data.Ys.data(), data.Zs.data(), (int)data.Xs.size());
+}
+
+static void PlotLineItem(const BenchmarkData& data) {
+    ImPlot3D::PlotLine("Line", data.Xs.data(), data.Ys.data(), data.Zs.data(), (int)data.Xs.size());
+}
+
+static void PlotTriangleItem(const BenchmarkData& data) {
+    ImPlot3D::PlotTriangle("Triangle", data.Xs.data(), data.Ys.data(), data.Zs.data(), (int)data.Xs.size());
+}
+
+static void PlotQuadItem(const BenchmarkData& data) {
+    ImPlot3D::PlotQuad("Quad", data.Xs.data(), data.Ys.data(), data.Zs.data(), (int)data.Xs.size());
+}
+
+static void PlotSurfaceItem(const BenchmarkData& data) {
+    ImPlot3D::PlotSurface("Surface", data.Xs.data(), data.Ys.data(), data.Zs.data(), data.XCount, data.YCount);
+}
+
+static void PlotMeshItem(const BenchmarkData& data) {
+    ImPlot3D::PlotMesh("Mesh", data.Vtx.data(), data.Idx.data(), (int)data.Vtx.size(), (int)data.Idx.size(), ImPlot3DMeshFlags_NoMarkers);
+}
+
+// One image per point (the texture is never sampled, there is no backend)
+static void PlotImageItem(const BenchmarkData& data) {
+    const ImTextureID tex_id = (ImTextureID)1;
+    for (size_t i = 0; i < data.Xs.size(); i++)
+        ImPlot3D::PlotImage("Image", tex_id, ImPlot3DPoint(data.Xs[i], data.Ys[i], data.Zs[i]), ImPlot3DPoint(0.01f, 0.0f, 0.0f),
+                            ImPlot3DPoint(0.0f, 0.0f, 0.01f));
+}
+
+// One label per point
+static void PlotTextItem(const BenchmarkData& data) {
+    for (size_t i = 0; i < data.Xs.size(); i++)
+        ImPlot3D::PlotText("Text", data.Xs[i], data.Ys[i], data.Zs[i]);
+}
+
+static const BenchmarkItem ITEMS[] = {
+    {"PlotScatter", SetupPoints, PlotScatterItem, 10000000},
+    {"PlotLine", SetupLine, PlotLineItem, 10000000},
+    {"PlotTriangle", SetupTriangles, PlotTriangleItem, 10000000},
+    {"PlotQuad", SetupQuads, PlotQuadItem, 10000000},
+    {"PlotSurface", SetupSurface, PlotSurfaceItem, 10000000},
+    {"PlotMesh", SetupMesh, PlotMeshItem, 10000000},
+    {"PlotImage", SetupPoints, PlotImageItem, 1000000}, // One item per element, 1e7 items take minutes per frame
+    {"PlotText", SetupPoints, PlotTextItem, 1000000},
+};
+
+// Starts a frame with a plot filling the display. Returns false if the plot isn't shown
+static bool BeginFrame(bool rotate, int frame) {
+    ImGuiIO& io = ImGui::GetIO();
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(io.DisplaySize);
+    ImGui::Begin("Benchmark", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings);
+    if (!ImPlot3D::BeginPlot("##Benchmark", ImVec2(-1, -1), ImPlot3DFlags_CanvasOnly))
+        return false;
+    ImPlot3D::SetupAxesLimits(-1.1, 1.1, -1.1, 1.1, -1.1, 1.1, ImPlot3DCond_Always);
+    ImPlot3D::SetupBoxRotation(25.0f, rotate ? -135.0f + frame : -135.0f, false, ImPlot3DCond_Always);
+    return true;
+}
+
+// Ends the frame started with BeginFrame(), plot_shown is its return value
+static void EndFrame(bool plot_shown) {
+    if (plot_shown)
+        ImPlot3D::EndPlot();
+    ImGui::End();
+    ImGui::Render();
+}
+
+// Renders one frame plotting an item in a plot filling the display. Returns the frame time in milliseconds
+static double RenderFrame(const BenchmarkItem& item, const BenchmarkData& data, bool rotate, int frame) {
+    const Clock::time_point start = Clock::now();
+    const bool plot_shown = BeginFrame(rotate, frame);
+    if (plot_shown)
+        item.Plot(data);
+    EndFrame(plot_shown);
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Hashes the vertices of the last rendered frame
+static ImGuiID HashFrameVertices() {
+    const ImDrawData* draw_data = ImGui::GetDrawData();
+    ImGuiID hash = 0;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+        hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), hash);
+    return hash;
+}
+
+// Renders frames until min_time seconds have passed (at least 3 frames, after a warm-up frame) and writes the results
+static void RunItem(FILE* out, const BenchmarkItem& item, const BenchmarkData& data, int count, bool rotate, double min_time) {
+    RenderFrame(item, data, rotate, 0);
+    double total_ms = 0.0;
+    int frames = 0;
+    while (frames < 3 || (total_ms < min_time * 1000.0 && frames < 1000))
+        total_ms += RenderFrame(item, data, rotate, ++frames);
+    const ImDrawData* draw_data = ImGui::GetDrawData();
+    const size_t bytes = (size_t)draw_data->TotalVtxCount * sizeof(ImDrawVert) + (size_t)draw_data->TotalIdxCount * sizeof(ImDrawIdx);
+    fprintf(out, "%s,%d,%s,%d,%.4f,%d,%d,%zu\n", item.Name, count, rotate ? "rotating" : "fixed", frames, total_ms / frames,
+            draw_data->TotalVtxCount, draw_data->TotalIdxCount, bytes);
+    fflush(out);
+}
+
+// Renders a few frames and counts the allocations made after the second one. Returns false if there are any
+static bool CheckAllocations(FILE* out, const BenchmarkItem& item, const BenchmarkData& data, int count, bool rotate) {
+    const int frame_count = 10;
+    RenderFrame(item, data, rotate, 0);
+    RenderFrame(item, data, rotate, 1);
+    ImPlot3D::SetAllocationCounting(true);
+    for (int frame = 2; frame < frame_count; frame++)
+        RenderFrame(item, data, rotate, frame);
+    const int allocations = ImPlot3D::GetAllocationCount();
+    ImPlot3D::SetAllocationCounting(false);
+    fprintf(out, "%s,%d,%s,%d,%d\n", item.Name, count, rotate ? "rotating" : "fixed", frame_count, allocations);
+    fflush(out);
+    return allocations == 0;
+}
+
+// Submits two command lists recording the same item with different points on alternate frames, as a double-buffered worker does, and checks
+// that each frame renders the points of its list instead of reusing the output of the other list. Returns false if a frame doesn't
+static bool CheckCommandLists(FILE* out, const BenchmarkData& data, int count) {
+    ImPlot3DCommandList lists[2];
+    std::vector<float> zs(data.Zs.size());
+    for (size_t i = 0; i < zs.size(); i++)
+        zs[i] = -data.Zs[i];
+    lists[0].PlotScatter("Points", data.Xs.data(), data.Ys.data(), data.Zs.data(), count);
+    lists[1].PlotScatter("Points", data.Xs.data(), data.Ys.data(), zs.data(), count);
+
+    // Hashes of the frames of each list, both lists are rendered once before comparing
+    const int frame_count = 10;
+    ImGuiID hashes[2] = {0, 0};
+    int failures = 0;
+    for (int frame = 0; frame < frame_count; frame++) {
+        const int list_idx = frame % 2;
+        const bool plot_shown = BeginFrame(false, frame);
+        if (plot_shown)
+            ImPlot3D::SubmitCommandList(lists[list_idx]);
+        EndFrame(plot_shown);
+        const ImGuiID hash = HashFrameVertices();
+        if (frame >= 2 && (hash != hashes[list_idx] || hash == hashes[1 - list_idx]))
+            failures++;
+        hashes[list_idx] = hash;
+    }
+    fprintf(out, "CommandList,%d,fixed,%d,%d\n", count, frame_count, failures);
+    fflush(out);
+    return failures == 0;
+}
+
+// Loads a mesh until min_time seconds have passed (at least 3 times) and writes the results
+static void RunLoadMesh(FILE* out, const char* path, double min_time) {
+    ImPlot3DMeshData mesh;
+    double total_ms = 0.0;
+    int loads = 0;
+    while (loads < 3 || total_ms < min_time * 1000.0) {
+        const Clock::time_point start = Clock::now();
+        if (!ImPlot3D::LoadMesh(path, &mesh, ImPlot3DLoadMeshFlags_Parallel)) {
+            fprintf(stderr, "Failed to load %s: %s\n", path, mesh.Error);
+            return;
+        }
+        total_ms += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        loads++;
+    }
+    const size_t bytes = (size_t)mesh.Vertices.size_in_bytes() + (size_t)mesh.Indices.size_in_bytes();
+    fprintf(out, "LoadMesh,%d,-,%d,%.4f,%d,%d,%zu\n", mesh.Indices.Size / 3, loads, total_ms / loads, mesh.Vertices.Size, mesh.Indices.Size,
+            bytes);
+    fflush(out);
+}
+
+int main(int argc, char** argv) {
+    // Parse arguments
+    int max_count = 10000000;
+    double min_time = 1.0;
+    const char* item_filter = nullptr;
+    const char* output_path = nullptr;
+    bool check_allocations = false;
+    bool check_command_lists = false;
+    std::vector<const char*> mesh_paths;
+    for (int i = 1; i < argc; i++) {
+        const bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--max-count") == 0 && has_value)
+            max_count = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--min-time") == 0 && has_value)
+            min_time = atof(argv[++i]);
+        else if (strcmp(argv[i], "--item") == 0 && has_value)
+            item_filter = argv[++i];
+        else if (strcmp(argv[i], "--mesh") == 0 && has_value)
+            mesh_paths.push_back(argv[++i]);
+        else if (strcmp(argv[i], "--output") == 0 && has_value)
+            output_path = argv[++i];
+        else if (strcmp(argv[i], "--check-allocations") == 0)
+            check_allocations = true;
+        else if (strcmp(argv[i], "--check-command-lists") == 0)
+            check_command_lists = true;
+        else {
+            fprintf(stderr,
+                    "Usage: %s [--max-count N] [--min-time SECONDS] [--item NAME] [--mesh FILE]... [--output FILE] [--check-allocations] "
+                    "[--check-command-lists]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+    FILE* out = output_path != nullptr ? fopen(output_path, "w") : stdout;
+    if (out == nullptr) {
+        fprintf(stderr, "Failed to open %s\n", output_path);
+        return 1;
+    }
+
+    // Setup context, without backend
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImPlot3D::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(1920, 1080);
+    unsigned char* font_pixels;
+    int font_width, font_height;
+    io.Fonts->GetTexDataAsRGBA32(&font_pixels, &font_width, &font_height);
+
+    // Check that the frames after warm-up don't allocate
+    BenchmarkData data;
+    if (check_allocations) {
+        bool success = true;
+        fprintf(out, "item,count,camera,frames,allocations\n");
+        for (const BenchmarkItem& item : ITEMS) {
+            if (item_filter != nullptr && strcmp(item_filter, item.Name) != 0)
+                continue;
+            item.Setup(data, 100000);
+            success &= CheckAllocations(out, item, data, 100000, false);
+            success &= CheckAllocations(out, item, data, 100000, true);
+            data = BenchmarkData();
+        }
+        ImPlot3D::DestroyContext();
+        ImGui::DestroyContext();
+        if (out != stdout)
+            fclose(out);
+        return success ? 0 : 1;
+    }
+
+    // Check that alternating command lists render their own points
+    if (check_command_lists) {
+        fprintf(out, "item,count,camera,frames,failures\n");
+        SetupPoints(data, 1000);
+        const bool success = CheckCommandLists(out, data, 1000);
+        ImPlot3D::DestroyContext();
+        ImGui::DestroyContext();
+        if (out != stdout)
+            fclose(out);
+        return success ? 0 : 1;
+    }
+
+    // Sweep the items from 1e3 elements
+    fprintf(out, "item,count,camera,frames,ms_per_frame,vertices,indices,bytes\n");
+    for (const BenchmarkItem& item : ITEMS) {
+        if (item_filter != nullptr && strcmp(item_filter, item.Name) != 0)
+            continue;
+        for (int count = 1000; count <= ImMin(max_count, item.MaxCount); count *= 10) {
+            item.Setup(data, count);
+            RunItem(out, item, data, count, false, min_time);
+            RunItem(out, item, data, count, true, min_time);
+        }
+        data = BenchmarkData();
+    }
+    for (const char* path : mesh_paths)
+        RunLoadMesh(out, path, min_time);
+
+    // Cleanup
+    ImPlot3D::DestroyContext();
+    ImGui::DestroyContext();
+    if (out != stdout)
+        fclose(out);
+    return 0;
+}
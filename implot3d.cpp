@@ -35,8 +35,12 @@
 // [SECTION] ImPlot3DBox
 // [SECTION] ImPlot3DRange
 // [SECTION] ImPlot3DQuat
+// [SECTION] ImPlot3DStream
+// [SECTION] ImPlot3DSPSCBuffer
 // [SECTION] ImDrawList3D
 // [SECTION] ImPlot3DAxis
+// [SECTION] ImPlot3DItemGroup
+// [SECTION] ImPlot3DTextCache
 // [SECTION] ImPlot3DPlot
 // [SECTION] ImPlot3DStyle
 // [SECTION] Metrics
@@ -57,6 +61,14 @@
 #include "implot3d.h"
 #include "implot3d_internal.h"
 
+#include <atomic>
+
+#ifndef IMPLOT3D_DISABLE_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
 #ifndef IMGUI_DISABLE
 
 //-----------------------------------------------------------------------------
@@ -67,6 +79,26 @@
     IM_ASSERT_USER_ERROR(GImPlot3D != nullptr, "No current context. Did you call ImPlot3D::CreateContext() or ImPlot3D::SetCurrentContext()?")
 #define IMPLOT3D_CHECK_PLOT() IM_ASSERT_USER_ERROR(GImPlot3D->CurrentPlot != nullptr, "No active plot. Did you call ImPlot3D::BeginPlot()?")
 
+#ifndef IMPLOT3D_DISABLE_THREADS
+// Workers of the built-in parallel for. They are started the first time a parallel for needs them and wait for the next batch of jobs
+// between calls, so rendering large items does not create threads (nor allocate) every frame
+struct ImPlot3DThreadPool {
+    std::thread Workers[IMPLOT3D_MAX_JOBS - 1];
+    int WorkerCount = 0;
+    std::mutex Mutex;
+    std::condition_variable StartCond; // Signaled when a batch starts or the pool quits
+    std::condition_variable DoneCond;  // Signaled when the last worker finished its jobs of the batch
+    // Current batch, worker i runs the jobs i + 1, i + 1 + Stride, ... if i + 1 < Stride
+    ImPlot3DJob Job = nullptr;
+    void* JobData = nullptr;
+    int Count = 0;
+    int Stride = 0;
+    unsigned int Batch = 0; // Incremented when a batch starts
+    int Pending = 0;        // Workers that did not finish the current batch
+    bool Quit = false;
+};
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] Context
 //-----------------------------------------------------------------------------
@@ -75,8 +107,12 @@ namespace ImPlot3D {
 
 // Global ImPlot3D context
 #ifndef GImPlot3D
+#ifdef IMPLOT3D_THREAD_LOCAL_CONTEXT
+thread_local ImPlot3DContext* GImPlot3D = nullptr;
+#else
 ImPlot3DContext* GImPlot3D = nullptr;
 #endif
+#endif
 
 ImPlot3DContext* CreateContext() {
     ImPlot3DContext* ctx = IM_NEW(ImPlot3DContext)();
@@ -91,6 +127,7 @@ void DestroyContext(ImPlot3DContext* ctx) {
         ctx = GImPlot3D;
     if (GImPlot3D == ctx)
         SetCurrentContext(nullptr);
+    DestroyThreadPool(ctx);
     IM_DELETE(ctx);
 }
 
@@ -98,14 +135,30 @@ ImPlot3DContext* GetCurrentContext() { return GImPlot3D; }
 
 void SetCurrentContext(ImPlot3DContext* ctx) { GImPlot3D = ctx; }
 
+void SetParallelFor(ImPlot3DParallelFor parallel_for, void* user_data, int max_jobs) {
+    IMPLOT3D_CHECK_CTX();
+    IM_ASSERT_USER_ERROR(max_jobs >= 0, "max_jobs must be positive or zero!");
+    ImPlot3DContext& gp = *GImPlot3D;
+    gp.ParallelFor = parallel_for;
+    gp.ParallelForUserData = user_data;
+    gp.ParallelMaxJobs = max_jobs;
+}
+
+void SetDrawListTrimPolicy(int frame_count, float fraction) {
+    IMPLOT3D_CHECK_CTX();
+    IM_ASSERT_USER_ERROR(frame_count >= 0, "frame_count must be positive or zero!");
+    IM_ASSERT_USER_ERROR(fraction >= 0.0f && fraction <= 1.0f, "fraction must be between 0 and 1!");
+    ImPlot3DContext& gp = *GImPlot3D;
+    gp.DrawListTrimFrames = frame_count;
+    gp.DrawListTrimFraction = fraction;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Text Utils
 //-----------------------------------------------------------------------------
 
-void AddTextRotated(ImDrawList* draw_list, ImVec2 pos, float angle, ImU32 col, const char* text_begin, const char* text_end) {
-    if (!text_end)
-        text_end = text_begin + strlen(text_begin);
-
+// Append the glyph quads of the text rotated by angle around the origin (4 vertices per glyph, colors are not set)
+static void LayoutTextRotated(ImVector<ImDrawVert>& vtx, float angle, const char* text_begin, const char* text_end) {
     ImGuiContext& g = *GImGui;
     ImFont* font = g.Font;
 
@@ -116,9 +169,6 @@ void AddTextRotated(ImDrawList* draw_list, ImVec2 pos, float angle, ImU32 col, c
     const float scale = g.FontSize / font->FontSize;
 #endif
 
-    // Align to be pixel perfect
-    pos = ImFloor(pos);
-
     // Measure the size of the text in unrotated coordinates
     ImVec2 text_size = font->CalcTextSizeA(g.FontSize, FLT_MAX, 0.0f, text_begin, text_end, nullptr);
 
@@ -126,16 +176,10 @@ void AddTextRotated(ImDrawList* draw_list, ImVec2 pos, float angle, ImU32 col, c
     float cos_a = cosf(-angle);
     float sin_a = sinf(-angle);
 
-    const char* s = text_begin;
-    int chars_total = (int)(text_end - s);
-    int chars_rendered = 0;
-    const int vtx_count_max = chars_total * 4;
-    const int idx_count_max = chars_total * 6;
-    draw_list->PrimReserve(idx_count_max, vtx_count_max);
-
     // Adjust pen position to center the text
     ImVec2 pen = ImVec2(-text_size.x * 0.5f, -text_size.y * 0.5f);
 
+    const char* s = text_begin;
     while (s < text_end) {
         unsigned int c = (unsigned int)*s;
         if (c < 0x80) {
@@ -159,38 +203,101 @@ void AddTextRotated(ImDrawList* draw_list, ImVec2 pos, float angle, ImU32 col, c
         ImVec2 glyph_offset = ImVec2(glyph->X0, glyph->Y0) * scale;
         ImVec2 glyph_size = ImVec2(glyph->X1 - glyph->X0, glyph->Y1 - glyph->Y0) * scale;
 
-        // Corners of the glyph quad in unrotated space
-        ImVec2 corners[4];
-        corners[0] = pen + glyph_offset;
-        corners[1] = pen + glyph_offset + ImVec2(glyph_size.x, 0);
-        corners[2] = pen + glyph_offset + glyph_size;
-        corners[3] = pen + glyph_offset + ImVec2(0, glyph_size.y);
-
-        // Rotate and translate the corners
+        // Corners of the glyph quad in unrotated space and their texture coordinates
+        ImDrawVert corners[4];
+        corners[0].pos = pen + glyph_offset;
+        corners[1].pos = pen + glyph_offset + ImVec2(glyph_size.x, 0);
+        corners[2].pos = pen + glyph_offset + glyph_size;
+        corners[3].pos = pen + glyph_offset + ImVec2(0, glyph_size.y);
+        corners[0].uv = ImVec2(glyph->U0, glyph->V0);
+        corners[1].uv = ImVec2(glyph->U1, glyph->V0);
+        corners[2].uv = ImVec2(glyph->U1, glyph->V1);
+        corners[3].uv = ImVec2(glyph->U0, glyph->V1);
+
+        // Rotate the corners
         for (int i = 0; i < 4; i++) {
-            float x = corners[i].x;
-            float y = corners[i].y;
-            corners[i].x = x * cos_a - y * sin_a + pos.x;
-            corners[i].y = x * sin_a + y * cos_a + pos.y;
+            float x = corners[i].pos.x;
+            float y = corners[i].pos.y;
+            corners[i].pos.x = x * cos_a - y * sin_a;
+            corners[i].pos.y = x * sin_a + y * cos_a;
+            corners[i].col = 0;
+            vtx.push_back(corners[i]);
         }
 
-        // Texture coordinates
-        ImVec2 uv0 = ImVec2(glyph->U0, glyph->V0);
-        ImVec2 uv1 = ImVec2(glyph->U1, glyph->V1);
-
-        // Render the glyph quad
-        draw_list->PrimQuadUV(corners[0], corners[1], corners[2], corners[3], uv0, ImVec2(glyph->U1, glyph->V0), uv1, ImVec2(glyph->U0, glyph->V1),
-                              col);
-
         // Advance the pen position
         pen.x += glyph->AdvanceX * scale;
+    }
+}
 
-        chars_rendered++;
+// Render glyph quads laid out by LayoutTextRotated() at pos
+static void RenderTextQuads(ImDrawList* draw_list, const ImDrawVert* vtx, int vtx_count, ImVec2 pos, ImU32 col) {
+    if (vtx_count == 0)
+        return;
+    draw_list->PrimReserve(vtx_count / 4 * 6, vtx_count);
+    for (int i = 0; i < vtx_count; i += 4) {
+        ImDrawIdx idx = (ImDrawIdx)draw_list->_VtxCurrentIdx;
+        ImDrawVert* vtx_out = draw_list->_VtxWritePtr;
+        for (int j = 0; j < 4; j++) {
+            vtx_out[j].pos.x = vtx[i + j].pos.x + pos.x;
+            vtx_out[j].pos.y = vtx[i + j].pos.y + pos.y;
+            vtx_out[j].uv = vtx[i + j].uv;
+            vtx_out[j].col = col;
+        }
+        ImDrawIdx* idx_out = draw_list->_IdxWritePtr;
+        idx_out[0] = idx;
+        idx_out[1] = (ImDrawIdx)(idx + 1);
+        idx_out[2] = (ImDrawIdx)(idx + 2);
+        idx_out[3] = idx;
+        idx_out[4] = (ImDrawIdx)(idx + 2);
+        idx_out[5] = (ImDrawIdx)(idx + 3);
+        draw_list->_VtxWritePtr += 4;
+        draw_list->_IdxWritePtr += 6;
+        draw_list->_VtxCurrentIdx += 4;
+    }
+}
+
+void AddTextRotated(ImDrawList* draw_list, ImVec2 pos, float angle, ImU32 col, const char* text_begin, const char* text_end) {
+    if (!text_end)
+        text_end = text_begin + strlen(text_begin);
+
+    // Align to be pixel perfect
+    pos = ImFloor(pos);
+
+    // Look for the rotated glyph quads in the plot text cache
+    ImGuiContext& g = *GImGui;
+    ImPlot3DPlot* plot = GImPlot3D != nullptr ? GImPlot3D->CurrentPlot : nullptr;
+    ImGuiID key = ImHashData(text_begin, (size_t)(text_end - text_begin));
+    key = ImHashData(&g.Font, sizeof(ImFont*), key);
+    key = ImHashData(&g.FontSize, sizeof(float), key);
+    key = ImHashData(&angle, sizeof(float), key);
+    key = ImHashData(&g.DrawListSharedData.TexUvWhitePixel, sizeof(ImVec2), key); // Changes when the font atlas is rebuilt
+    bool collision = false;
+    ImPlot3DTextCache::Entry* entry = plot != nullptr ? plot->TextCache.GetEntry(key, text_begin, text_end, &collision) : nullptr;
+
+    // Without a current plot, or if another text has the same key, lay out the text without caching it
+    if (plot == nullptr || collision) {
+        ImVector<ImDrawVert> vtx;
+        LayoutTextRotated(vtx, angle, text_begin, text_end);
+        RenderTextQuads(draw_list, vtx.Data, vtx.Size, pos, col);
+        return;
     }
 
-    // Return unused vertices
-    int chars_skipped = chars_total - chars_rendered;
-    draw_list->PrimUnreserve(chars_skipped * 6, chars_skipped * 4);
+    ImPlot3DTextCache& cache = plot->TextCache;
+    if (entry == nullptr) {
+        ImPlot3DTextCache::Entry new_entry;
+        new_entry.Key = key;
+        new_entry.TextOffset = cache.Text.Size;
+        new_entry.TextLength = (int)(text_end - text_begin);
+        cache.Text.resize(cache.Text.Size + new_entry.TextLength);
+        memcpy(cache.Text.Data + new_entry.TextOffset, text_begin, (size_t)new_entry.TextLength);
+        new_entry.VtxOffset = cache.Vtx.Size;
+        LayoutTextRotated(cache.Vtx, angle, text_begin, text_end);
+        new_entry.VtxCount = cache.Vtx.Size - new_entry.VtxOffset;
+        new_entry.LastFrame = -1;
+        entry = cache.AddEntry(new_entry);
+    }
+    cache.MarkUsed(*entry);
+    RenderTextQuads(draw_list, cache.Vtx.Data + entry->VtxOffset, entry->VtxCount, pos, col);
 }
 
 void AddTextCentered(ImDrawList* draw_list, ImVec2 top_center, ImU32 col, const char* text_begin) {
@@ -252,12 +359,19 @@ ImVec2 CalcLegendSize(ImPlot3DItemGroup& items, const ImVec2& pad, const ImVec2&
     const int nItems = items.GetLegendCount();
     const float txt_ht = ImGui::GetTextLineHeight();
     const float icon_size = txt_ht;
+    // Labels are measured once, and again when the font changes
+    ImPlot3DLegend& legend = items.Legend;
+    if (legend.NameWidthFont != ImGui::GetFont() || legend.NameWidthFontSize != ImGui::GetFontSize()) {
+        for (int i = 0; i < items.GetItemCount(); i++)
+            items.GetItemByIndex(i)->NameWidth = -1.0f;
+        legend.NameWidthFont = ImGui::GetFont();
+        legend.NameWidthFontSize = ImGui::GetFontSize();
+    }
     // Get label max width
     float max_label_width = 0;
     float sum_label_width = 0;
     for (int i = 0; i < nItems; i++) {
-        const char* label = items.GetLegendLabel(i);
-        const float label_width = ImGui::CalcTextSize(label, nullptr, true).x;
+        const float label_width = items.GetLegendLabelWidth(i);
         max_label_width = label_width > max_label_width ? label_width : max_label_width;
         sum_label_width += label_width;
     }
@@ -280,15 +394,30 @@ void ShowLegendEntries(ImPlot3DItemGroup& items, const ImRect& legend_bb, bool h
     if (num_items == 0)
         return;
 
+    // Only the visible entries are processed: the rows in the scrolled legend rect, or the columns in the clip rect
+    int first = 0;
+    int last = num_items;
+    if (vertical) {
+        const float row_height = txt_ht + spacing.y;
+        first = ImClamp((int)(items.Legend.Scroll / row_height), 0, num_items);
+        last = ImClamp((int)((items.Legend.Scroll + legend_bb.GetHeight()) / row_height) + 1, first, num_items);
+    }
+    const float clip_min_x = draw_list.GetClipRectMin().x;
+    const float clip_max_x = draw_list.GetClipRectMax().x;
+
     // Render legend items
-    for (int i = 0; i < num_items; i++) {
+    for (int i = first; i < last; i++) {
         const int idx = i;
         ImPlot3DItem* item = items.GetLegendItem(idx);
         const char* label = items.GetLegendLabel(idx);
-        const float label_width = ImGui::CalcTextSize(label, nullptr, true).x;
-        const ImVec2 top_left = vertical ? legend_bb.Min + pad + ImVec2(0, i * (txt_ht + spacing.y))
+        const float label_width = items.GetLegendLabelWidth(idx);
+        const ImVec2 top_left = vertical ? legend_bb.Min + pad + ImVec2(0, i * (txt_ht + spacing.y) - items.Legend.Scroll)
                                          : legend_bb.Min + pad + ImVec2(i * (icon_size + spacing.x) + sum_label_width, 0);
         sum_label_width += label_width;
+        if (!vertical && top_left.x > clip_max_x)
+            break;
+        if (!vertical && top_left.x + icon_size + label_width < clip_min_x)
+            continue;
         ImRect icon_bb;
         icon_bb.Min = top_left + ImVec2(icon_shrink, icon_shrink);
         icon_bb.Max = top_left + ImVec2(icon_size - icon_shrink, icon_size - icon_shrink);
@@ -299,6 +428,8 @@ void ShowLegendEntries(ImPlot3DItemGroup& items, const ImRect& legend_bb, bool h
         ImU32 col_item = ImAlphaU32(item->Color, 1);
 
         ImRect button_bb(icon_bb.Min, label_bb.Max);
+        if (items.Legend.Scrollable)
+            button_bb.ClipWith(legend_bb);
 
         ImGui::KeepAliveID(item->ID);
 
@@ -348,13 +479,29 @@ void RenderLegend() {
 
     ImPlot3DLegend& legend = plot.Items.Legend;
     const bool legend_horz = ImPlot3D::ImHasFlag(legend.Flags, ImPlot3DLegendFlags_Horizontal);
-    const ImVec2 legend_size = CalcLegendSize(plot.Items, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, !legend_horz);
+    ImVec2 legend_size = CalcLegendSize(plot.Items, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, !legend_horz);
+
+    // A vertical legend taller than the plot is clamped to the plot height and scrolled with the mouse wheel
+    const float content_height = legend_size.y;
+    const float max_height = ImMax(plot.PlotRect.GetHeight() - 2 * gp.Style.LegendPadding.y, ImGui::GetTextLineHeight());
+    legend.Scrollable = !legend_horz && content_height > max_height;
+    if (legend.Scrollable)
+        legend_size.y = max_height;
     const ImVec2 legend_pos = GetLocationPos(plot.PlotRect, legend_size, legend.Location, gp.Style.LegendPadding);
     legend.Rect = ImRect(legend_pos, legend_pos + legend_size);
 
     // Test hover
     legend.Hovered = legend.Rect.Contains(IO.MousePos);
 
+    // Scroll
+    if (legend.Scrollable) {
+        if (legend.Hovered && IO.MouseWheel != 0.0f)
+            legend.Scroll -= IO.MouseWheel * 3 * (ImGui::GetTextLineHeight() + gp.Style.LegendSpacing.y);
+        legend.Scroll = ImClamp(legend.Scroll, 0.0f, content_height - legend_size.y);
+    } else {
+        legend.Scroll = 0.0f;
+    }
+
     // Render background
     ImU32 col_bg = GetStyleColorU32(ImPlot3DCol_LegendBg);
     ImU32 col_bd = GetStyleColorU32(ImPlot3DCol_LegendBorder);
@@ -362,7 +509,13 @@ void RenderLegend() {
     draw_list->AddRect(legend.Rect.Min, legend.Rect.Max, col_bd);
 
     // Render legends
+    if (legend.Scrollable) {
+        const ImVec2 clip_pad(0, gp.Style.LegendInnerPadding.y);
+        draw_list->PushClipRect(legend.Rect.Min + clip_pad, legend.Rect.Max - clip_pad, true);
+    }
     ShowLegendEntries(plot.Items, legend.Rect, legend.Hovered, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, !legend_horz, *draw_list);
+    if (legend.Scrollable)
+        draw_list->PopClipRect();
 }
 
 //-----------------------------------------------------------------------------
@@ -384,22 +537,21 @@ void RenderMousePos() {
 
     char buff[IMPLOT3D_LABEL_MAX_SIZE];
     if (!mouse_plot_pos.IsNaN()) {
-        ImGuiTextBuffer builder;
-        builder.append("(");
+        // Formatted on the stack, the mouse text is rebuilt every frame
+        char text[3 * IMPLOT3D_LABEL_MAX_SIZE + 8];
+        int len = ImFormatString(text, sizeof(text), "(");
         for (int i = 0; i < 3; i++) {
             ImPlot3DAxis& axis = plot.Axes[i];
-            if (i > 0)
-                builder.append(", ");
             axis.Formatter(mouse_plot_pos[i], buff, IMPLOT3D_LABEL_MAX_SIZE, axis.FormatterData);
-            builder.append(buff);
+            len += ImFormatString(text + len, sizeof(text) - len, i > 0 ? ", %s" : "%s", buff);
         }
-        builder.append(")");
+        ImFormatString(text + len, sizeof(text) - len, ")");
 
-        const ImVec2 size = ImGui::CalcTextSize(builder.c_str());
+        const ImVec2 size = ImGui::CalcTextSize(text);
         // TODO custom location/padding
         const ImVec2 pos = GetLocationPos(plot.PlotRect, size, ImPlot3DLocation_SouthEast, ImVec2(10, 10));
         ImDrawList& draw_list = *ImGui::GetWindowDrawList();
-        draw_list.AddText(pos, GetStyleColorU32(ImPlot3DCol_InlayText), builder.c_str());
+        draw_list.AddText(pos, GetStyleColorU32(ImPlot3DCol_InlayText), text);
     }
 }
 
@@ -1197,12 +1349,12 @@ void Locator_Default(ImPlot3DTicker& ticker, const ImPlot3DRange& range, float p
                 first_major_idx = ticker.TickCount();
                 first_major_set = true;
             }
-            ticker.AddTick(major, true, true, formatter, formatter_data);
+            ticker.AddTick(major, true, true, nullptr);
         }
         for (int i = 1; i < nMinor; i++) {
             double minor = major + i * interval / nMinor;
             if (range.Contains((float)minor)) {
-                ticker.AddTick(minor, false, true, formatter, formatter_data);
+                ticker.AddTick(minor, false, true, nullptr);
             }
         }
     }
@@ -1214,6 +1366,9 @@ void Locator_Default(ImPlot3DTicker& ticker, const ImPlot3DRange& range, float p
         for (int i = first_major_idx + 1; i < ticker.TickCount(); i += 2)
             ticker.Ticks[i].ShowLabel = false;
     }
+
+    // Format the labels that were not pruned
+    ticker.FormatLabels(idx0, formatter, formatter_data);
 }
 
 void AddTicksCustom(const double* values, const char* const labels[], int n, ImPlot3DTicker& ticker, ImPlot3DFormatter formatter, void* data) {
@@ -1422,6 +1577,10 @@ bool BeginPlot(const char* title_id, const ImVec2& size, ImPlot3DFlags flags) {
     plot.SetupLocked = false;
     plot.OpenContextThisFrame = false;
     plot.RotationCond = ImPlot3DCond_None;
+    plot.ReusingOutput = false;
+    plot.ItemOutputs.shrink(0);
+    plot.ItemsHash = 0;
+    plot.HasUnversionedItems = false;
 
     // Populate title
     plot.SetTitle(title_id);
@@ -1465,7 +1624,20 @@ void EndPlot() {
     ImPlot3DPlot& plot = *gp.CurrentPlot;
 
     // Move triangles from 3D draw list to ImGui draw list
-    plot.DrawList.SortedMoveToImGuiDrawList();
+    if (plot.ReusingOutput && plot.ItemOutputs.Size == plot.LastItemOutputs.Size) {
+        // Nothing changed since the last output, append it again without sorting
+        plot.DrawList.AppendLastToImGuiDrawList();
+    } else {
+        // Some items of the last output were not submitted this frame, restore the ones that were skipped
+        if (plot.ReusingOutput)
+            plot.RestoreLastOutput(plot.ItemOutputs.Size);
+        plot.DrawList.SortedMoveToImGuiDrawList();
+        plot.LastItemOutputs.swap(plot.ItemOutputs);
+        plot.LastViewHash = plot.ViewHash;
+        plot.LastOutputValid = true;
+    }
+    plot.ReusingOutput = false;
+    plot.DrawList.TrimUnused(gp.DrawListTrimFrames, gp.DrawListTrimFraction);
 
     // Handle data fitting
     if (plot.FitThisFrame) {
@@ -1491,7 +1663,9 @@ void EndPlot() {
     RenderMousePos();
 
     // Legend context menu
+    bool context_menu_open = false;
     if (ImGui::BeginPopup("##LegendContext")) {
+        context_menu_open = true;
         ImGui::Text("Legend");
         ImGui::Separator();
         if (ShowLegendContextMenu(plot.Items.Legend, !ImPlot3D::ImHasFlag(plot.Flags, ImPlot3DFlags_NoLegend)))
@@ -1503,6 +1677,7 @@ void EndPlot() {
     for (int i = 0; i < 3; i++) {
         ImPlot3DAxis& axis = plot.Axes[i];
         if (ImGui::BeginPopup(axis_contexts[i])) {
+            context_menu_open = true;
             ImGui::Text(axis.HasLabel() ? axis.GetLabel() : "%c-Axis", 'X' + i);
             ImGui::Separator();
             ShowAxisContextMenu(axis);
@@ -1513,6 +1688,7 @@ void EndPlot() {
     // Plane context menus
     for (int i = 0; i < 3; i++) {
         if (ImGui::BeginPopup(plane_contexts[i])) {
+            context_menu_open = true;
             ImGui::Text("%s", plane_labels[i]);
             ImGui::Separator();
             ShowPlaneContextMenu(plot, i);
@@ -1522,6 +1698,7 @@ void EndPlot() {
 
     // Plot context menu
     if (ImGui::BeginPopup("##PlotContext")) {
+        context_menu_open = true;
         ShowPlotContextMenu(plot);
         ImGui::EndPopup();
     }
@@ -1534,9 +1711,44 @@ void EndPlot() {
     gp.CurrentItems = nullptr;
     gp.CurrentItem = nullptr;
 
-    // Reset the plot items for the next frame
-    for (int i = 0; i < plot.Items.GetItemCount(); i++)
-        plot.Items.GetItemByIndex(i)->SeenThisFrame = false;
+    // Reset the plot items for the next frame. Their legend state changes how they are rendered in the next frame (hover highlight, hidden)
+    ImGuiID input_hash = 0;
+    for (int i = 0; i < plot.Items.GetItemCount(); i++) {
+        ImPlot3DItem* item = plot.Items.GetItemByIndex(i);
+        item->SeenThisFrame = false;
+        const bool legend_state[2] = {item->LegendHovered, item->Show};
+        input_hash = ImHashData(legend_state, sizeof(legend_state), input_hash);
+    }
+
+    // Drop the cached labels that are no longer rendered
+    plot.TextCache.GarbageCollect();
+    plot.Items.CompactLabels();
+
+    // The caches are shared by all plots, so they only need to be collected once per frame
+    if (gp.LastGarbageCollectFrame != ImGui::GetFrameCount()) {
+        gp.LastGarbageCollectFrame = ImGui::GetFrameCount();
+        GarbageCollectMeshLODs();
+        GarbageCollectIsosurfaces();
+        GarbageCollectVoxels();
+        GarbageCollectNormals();
+    }
+
+    // Hash the interaction state that isn't part of the view or of the items: hovered plot and axes, legend scroll and mouse text
+    const bool hovered[5] = {plot.Hovered, plot.Axes[0].Hovered, plot.Axes[1].Hovered, plot.Axes[2].Hovered, plot.Items.Legend.Hovered};
+    input_hash = ImHashData(hovered, sizeof(hovered), input_hash);
+    input_hash = ImHashData(&plot.Items.Legend.Scroll, sizeof(float), input_hash);
+    if (plot.Hovered && !ImPlot3D::ImHasFlag(plot.Flags, ImPlot3DFlags_NoMouseText))
+        input_hash = ImHashData(&ImGui::GetIO().MousePos, sizeof(ImVec2), input_hash);
+
+    // Check if the plot changed this frame or will change in the next frame without user input (e.g. fit, animation, dragging). Context
+    // menus are drawn over the plot and react to the mouse, so the plot stays dirty while one is open
+    ImGuiID frame_hash = ImHashData(&plot.ItemsHash, sizeof(ImGuiID), plot.ViewHash);
+    frame_hash = ImHashData(&input_hash, sizeof(ImGuiID), frame_hash);
+    bool any_axis_held = plot.Axes[0].Held || plot.Axes[1].Held || plot.Axes[2].Held;
+    plot.Dirty = frame_hash != plot.LastFrameHash || plot.HasUnversionedItems || plot.AnimationTime > 0.0f ||
+                 plot.CalcViewHash() != plot.ViewHash || plot.Held || any_axis_held || context_menu_open;
+    plot.LastFrameHash = frame_hash;
+    plot.LastFrameActive = ImGui::GetFrameCount();
 }
 
 //-----------------------------------------------------------------------------
@@ -1598,8 +1810,12 @@ void SetupAxisTicks(ImAxis3D idx, const double* values, int n_ticks, const char*
     ImPlot3DPlot& plot = *gp.CurrentPlot;
     ImPlot3DAxis& axis = plot.Axes[idx];
     axis.ShowDefaultTicks = keep_default;
-    AddTicksCustom(values, labels, n_ticks, axis.Ticker, axis.Formatter ? axis.Formatter : Formatter_Default,
-                   (axis.Formatter && axis.FormatterData) ? axis.FormatterData : (void*)IMPLOT3D_LABEL_FORMAT);
+    // Labels without text are formatted when the ticker is rebuilt
+    AddTicksCustom(values, labels, n_ticks, axis.CustomTicker, nullptr, nullptr);
+    axis.CustomTicksHash = ImHashData(values, sizeof(double) * n_ticks, axis.CustomTicksHash);
+    for (int i = 0; labels != nullptr && i < n_ticks; i++)
+        axis.CustomTicksHash = ImHashStr(labels[i], 0, axis.CustomTicksHash);
+    axis.CustomTicksHash = ImHashData(&n_ticks, sizeof(int), axis.CustomTicksHash);
 }
 
 void SetupAxisTicks(ImAxis3D idx, double v_min, double v_max, int n_ticks, const char* const labels[], bool keep_default) {
@@ -1607,9 +1823,8 @@ void SetupAxisTicks(ImAxis3D idx, double v_min, double v_max, int n_ticks, const
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr && !gp.CurrentPlot->SetupLocked,
                          "Setup needs to be called after BeginPlot and before any setup locking functions (e.g. PlotX)!");
     n_ticks = n_ticks < 2 ? 2 : n_ticks;
-    ImVector<double> temp;
-    FillRange(temp, n_ticks, v_min, v_max);
-    SetupAxisTicks(idx, temp.Data, n_ticks, labels, keep_default);
+    FillRange(gp.TempDouble, n_ticks, v_min, v_max);
+    SetupAxisTicks(idx, gp.TempDouble.Data, n_ticks, labels, keep_default);
 }
 
 void SetupAxisLimitsConstraints(ImAxis3D idx, double v_min, double v_max) {
@@ -1833,6 +2048,27 @@ ImVec2 GetPlotSize() {
     return gp.CurrentPlot->PlotRect.GetSize();
 }
 
+bool IsPlotDirty(const char* title_id) {
+    IMPLOT3D_CHECK_CTX();
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot == nullptr, "IsPlotDirty() needs to be called after EndPlot()!");
+    ImPlot3DPlot* plot = gp.Plots.GetByKey(ImGui::GetCurrentWindow()->GetID(title_id));
+    return plot == nullptr || plot->Dirty;
+}
+
+bool IsAnyPlotDirty() {
+    IMPLOT3D_CHECK_CTX();
+    ImPlot3DContext& gp = *GImPlot3D;
+    // Only consider plots submitted in the current or previous frame
+    const int frame_count = ImGui::GetFrameCount();
+    for (int p = 0; p < gp.Plots.GetBufSize(); p++) {
+        const ImPlot3DPlot& plot = *gp.Plots.GetByIndex(p);
+        if (plot.LastFrameActive >= frame_count - 1 && plot.Dirty)
+            return true;
+    }
+    return false;
+}
+
 ImVec2 GetFramePos() {
     ImPlot3DContext& gp = *GImPlot3D;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "GetFramePos() needs to be called between BeginPlot() and EndPlot()!");
@@ -2183,10 +2419,11 @@ void HandleInput(ImPlot3DPlot& plot) {
         plot.Rotation.Normalize();
     }
 
-    // Handle zoom with mouse wheel
+    // Handle zoom with mouse wheel (the wheel scrolls the legend instead when it is hovered and scrollable)
     if (plot.Hovered) {
         ImGui::SetKeyOwner(ImGuiKey_MouseWheelY, plot.ID);
-        if (ImGui::IsMouseDown(ImGuiMouseButton_Middle) || IO.MouseWheel != 0.0f) {
+        const bool scroll_legend = plot.Items.Legend.Hovered && plot.Items.Legend.Scrollable;
+        if (ImGui::IsMouseDown(ImGuiMouseButton_Middle) || (IO.MouseWheel != 0.0f && !scroll_legend)) {
             float delta = ImGui::IsMouseDown(ImGuiMouseButton_Middle) ? (-0.01f * IO.MouseDelta.y) : (-0.1f * IO.MouseWheel);
             float zoom = 1.0f + delta;
             for (int i = 0; i < 3; i++) {
@@ -2251,6 +2488,39 @@ void HandleInput(ImPlot3DPlot& plot) {
     }
 }
 
+// Rebuild the axis ticks if the range, pixel size, formatter, locator, font or custom ticks changed
+void UpdateTicker(ImPlot3DAxis& axis, float pixels) {
+    ImFont* font = ImGui::GetFont();
+    float font_size = ImGui::GetFontSize();
+    bool show_labels = axis.HasTickLabels();
+    ImGuiID hash = ImHashData(&axis.Range, sizeof(ImPlot3DRange), axis.CustomTicksHash);
+    hash = ImHashData(&pixels, sizeof(float), hash);
+    hash = ImHashData(&axis.Formatter, sizeof(ImPlot3DFormatter), hash);
+    hash = ImHashData(&axis.FormatterData, sizeof(void*), hash);
+    hash = ImHashData(&axis.Locator, sizeof(ImPlot3DLocator), hash);
+    hash = ImHashData(&axis.ShowDefaultTicks, sizeof(bool), hash);
+    hash = ImHashData(&show_labels, sizeof(bool), hash);
+    hash = ImHashData(&font, sizeof(ImFont*), hash);
+    hash = ImHashData(&font_size, sizeof(float), hash);
+    if (hash == axis.TickerHash)
+        return;
+    axis.TickerHash = hash;
+
+    // Labels are not formatted if they are not rendered
+    ImPlot3DFormatter formatter = show_labels ? axis.Formatter : nullptr;
+    ImPlot3DTicker& ticker = axis.Ticker;
+    ticker.Reset();
+    for (int t = 0; t < axis.CustomTicker.TickCount(); t++) {
+        const ImPlot3DTick& tick = axis.CustomTicker.Ticks[t];
+        const char* label = (show_labels && tick.TextOffset != -1) ? axis.CustomTicker.GetText(tick) : nullptr;
+        ticker.AddTick(tick.PlotPos, tick.Major, tick.ShowLabel, label);
+    }
+    ticker.FormatLabels(0, formatter, axis.FormatterData);
+    // Custom locators always receive the axis formatter, they may format labels themselves
+    if (axis.ShowDefaultTicks)
+        axis.Locator(ticker, axis.Range, pixels, axis.Locator == Locator_Default ? formatter : axis.Formatter, axis.FormatterData);
+}
+
 void SetupLock() {
     ImPlot3DContext& gp = *GImPlot3D;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "SetupLock() needs to be called between BeginPlot() and EndPlot()!");
@@ -2291,13 +2561,8 @@ void SetupLock() {
     plot.PlotRect = plot.CanvasRect;
 
     // Compute ticks
-    for (int i = 0; i < 3; i++) {
-        ImPlot3DAxis& axis = plot.Axes[i];
-        if (axis.ShowDefaultTicks) {
-            float pixels = plot.GetBoxZoom() * plot.BoxScale[i];
-            axis.Locator(axis.Ticker, axis.Range, pixels, axis.Formatter, axis.FormatterData);
-        }
-    }
+    for (int i = 0; i < 3; i++)
+        UpdateTicker(plot.Axes[i], plot.GetBoxZoom() * plot.BoxScale[i]);
 
     // Render title
     if (plot.HasTitle()) {
@@ -2325,6 +2590,10 @@ void SetupLock() {
     // Render plot box
     RenderPlotBox(draw_list, plot);
 
+    // Check if the last output can be reused (items are checked in ReuseItemOutput)
+    plot.ViewHash = plot.CalcViewHash();
+    plot.ReusingOutput = plot.LastOutputValid && plot.ViewHash == plot.LastViewHash && !plot.FitThisFrame;
+
     ImGui::PopClipRect();
 }
 
@@ -2651,6 +2920,25 @@ ImU32 SampleColormapU32(float t, ImPlot3DColormap cmap) {
 
 ImVec4 SampleColormap(float t, ImPlot3DColormap cmap) { return ImGui::ColorConvertU32ToFloat4(SampleColormapU32(t, cmap)); }
 
+void SampleColormapU32(const float* t, ImU32* out, int count, ImPlot3DColormap cmap) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    cmap = cmap == IMPLOT3D_AUTO ? gp.Style.Colormap : cmap;
+    IM_ASSERT_USER_ERROR(cmap >= 0 && cmap < gp.ColormapData.Count, "Invalid colormap index!");
+    const ImU32* table = gp.ColormapData.GetTable(cmap);
+    const int size = gp.ColormapData.GetTableSize(cmap);
+    const bool qual = gp.ColormapData.IsQual(cmap);
+    const float scale = (float)(qual ? size : size - 1);
+    const float round = qual ? 0.0f : 0.5f;
+    const float max_entry = (float)(size - 1);
+    // Entries are picked as in LerpTable(), straight from the table without converting colors to ImVec4
+    for (int i = 0; i < count; i++) {
+        float entry = t[i] * scale + round;
+        entry = entry > 0.0f ? entry : 0.0f; // Also maps NaN to the first entry
+        entry = entry < max_entry ? entry : max_entry;
+        out[i] = table[(int)entry];
+    }
+}
+
 void RenderColorBar(const ImU32* colors, int size, ImDrawList& DrawList, const ImRect& bounds, bool vert, bool reversed, bool continuous) {
     const int n = continuous ? size - 1 : size;
     ImU32 col1, col2;
@@ -2727,6 +3015,7 @@ bool ColormapSlider(const char* label, float* t, ImVec4* out, const char* format
 #define IM_RGB(r, g, b) IM_COL32(r, g, b, 255)
 
 void InitializeContext(ImPlot3DContext* ctx) {
+    ctx->ThreadPool = nullptr;
     ResetContext(ctx);
 
     const ImU32 Deep[] = {4289753676, 4283598045, 4285048917, 4283584196, 4289950337, 4284512403, 4291005402, 4287401100, 4285839820, 4291671396};
@@ -2788,8 +3077,156 @@ void ResetContext(ImPlot3DContext* ctx) {
     ctx->CurrentItem = nullptr;
     ctx->NextItemData.Reset();
     ctx->Style = ImPlot3DStyle();
+    ctx->ParallelFor = nullptr;
+    ctx->ParallelForUserData = nullptr;
+    ctx->ParallelMaxJobs = 0;
+    ctx->DrawListTrimFrames = 120;
+    ctx->DrawListTrimFraction = 0.25f;
+    ctx->Meshes.Clear();
+    ctx->LastMeshID = 0;
+    ctx->LastGarbageCollectFrame = -1;
+}
+
+int GetParallelJobCount() {
+    ImPlot3DContext& gp = *GImPlot3D;
+    int jobs = gp.ParallelMaxJobs;
+    if (jobs == 0) {
+#ifndef IMPLOT3D_DISABLE_THREADS
+        jobs = (int)std::thread::hardware_concurrency();
+#endif
+    }
+    return ImClamp(jobs, 1, IMPLOT3D_MAX_JOBS);
+}
+
+#ifndef IMPLOT3D_DISABLE_THREADS
+static void RunJobs(int first, int stride, int count, ImPlot3DJob job, void* job_data) {
+    for (int i = first; i < count; i += stride)
+        job(i, job_data);
+}
+
+static void RunWorker(ImPlot3DThreadPool* pool, int worker, unsigned int batch) {
+    std::unique_lock<std::mutex> lock(pool->Mutex);
+    while (true) {
+        pool->StartCond.wait(lock, [&] { return pool->Quit || pool->Batch != batch; });
+        if (pool->Quit)
+            return;
+        batch = pool->Batch;
+        const int first = worker + 1;
+        if (first < pool->Stride) {
+            const ImPlot3DJob job = pool->Job;
+            void* job_data = pool->JobData;
+            const int count = pool->Count, stride = pool->Stride;
+            lock.unlock();
+            RunJobs(first, stride, count, job, job_data);
+            lock.lock();
+        }
+        if (--pool->Pending == 0)
+            pool->DoneCond.notify_one();
+    }
+}
+
+// Runs the jobs on the calling thread and thread_count - 1 workers of the pool of the context
+static void RunJobsOnPool(ImPlot3DContext& gp, int thread_count, int count, ImPlot3DJob job, void* job_data) {
+    if (gp.ThreadPool == nullptr)
+        gp.ThreadPool = IM_NEW(ImPlot3DThreadPool)();
+    ImPlot3DThreadPool& pool = *gp.ThreadPool;
+    {
+        std::lock_guard<std::mutex> lock(pool.Mutex);
+        while (pool.WorkerCount < thread_count - 1) {
+            pool.Workers[pool.WorkerCount] = std::thread(RunWorker, &pool, pool.WorkerCount, pool.Batch);
+            pool.WorkerCount++;
+        }
+        pool.Job = job;
+        pool.JobData = job_data;
+        pool.Count = count;
+        pool.Stride = thread_count;
+        pool.Pending = pool.WorkerCount;
+        pool.Batch++;
+    }
+    pool.StartCond.notify_all();
+    RunJobs(0, thread_count, count, job, job_data);
+    std::unique_lock<std::mutex> lock(pool.Mutex);
+    pool.DoneCond.wait(lock, [&] { return pool.Pending == 0; });
+}
+#endif
+
+void DestroyThreadPool(ImPlot3DContext* ctx) {
+#ifndef IMPLOT3D_DISABLE_THREADS
+    ImPlot3DThreadPool* pool = ctx->ThreadPool;
+    if (pool == nullptr)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(pool->Mutex);
+        pool->Quit = true;
+    }
+    pool->StartCond.notify_all();
+    for (int i = 0; i < pool->WorkerCount; i++)
+        pool->Workers[i].join();
+    IM_DELETE(pool);
+    ctx->ThreadPool = nullptr;
+#else
+    IM_UNUSED(ctx);
+#endif
+}
+
+void ParallelFor(int count, ImPlot3DJob job, void* job_data) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    if (gp.ParallelFor != nullptr) {
+        gp.ParallelFor(count, job, job_data, gp.ParallelForUserData);
+        return;
+    }
+#ifndef IMPLOT3D_DISABLE_THREADS
+    // Run the first job on the calling thread and the others on the workers of the context
+    const int thread_count = ImMin(count, IMPLOT3D_MAX_JOBS);
+    if (thread_count > 1) {
+        RunJobsOnPool(gp, thread_count, count, job, job_data);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        job(i, job_data);
+}
+
+// Allocator wrapped by SetAllocationCounting()
+static ImGuiMemAllocFunc GCountedAllocFunc = nullptr;
+static ImGuiMemFreeFunc GCountedFreeFunc = nullptr;
+static void* GCountedUserData = nullptr;
+static std::atomic<int> GAllocationCount(0);
+
+static void* CountingAlloc(size_t size, void* user_data) {
+    IM_UNUSED(user_data);
+    GAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return GCountedAllocFunc(size, GCountedUserData);
+}
+
+static void CountingFree(void* ptr, void* user_data) {
+    IM_UNUSED(user_data);
+    GCountedFreeFunc(ptr, GCountedUserData);
+}
+
+void SetAllocationCounting(bool enabled) {
+    if (enabled == (GCountedAllocFunc != nullptr))
+        return;
+    if (enabled) {
+        // Memory allocated before or after counting can be freed by either allocator, both end up in the same functions
+        ImGui::GetAllocatorFunctions(&GCountedAllocFunc, &GCountedFreeFunc, &GCountedUserData);
+        GAllocationCount.store(0);
+        ImGui::SetAllocatorFunctions(CountingAlloc, CountingFree);
+    } else {
+        ImGui::SetAllocatorFunctions(GCountedAllocFunc, GCountedFreeFunc, GCountedUserData);
+        GCountedAllocFunc = nullptr;
+        GCountedFreeFunc = nullptr;
+        GCountedUserData = nullptr;
+    }
 }
 
+int GetAllocationCount() { return GAllocationCount.load(); }
+
+// Global so that objects recorded without a context (e.g. command lists on worker threads) get versions unique across contexts
+static std::atomic<ImU64> GLastSourceVersion(0);
+
+ImU64 NewSourceVersion() { return GLastSourceVersion.fetch_add(1, std::memory_order_relaxed) + 1; }
+
 //-----------------------------------------------------------------------------
 // [SECTION] Style Utils
 //-----------------------------------------------------------------------------
@@ -3148,6 +3585,179 @@ ImPlot3DQuat ImPlot3DQuat::Slerp(const ImPlot3DQuat& q1, const ImPlot3DQuat& q2,
 
 float ImPlot3DQuat::Dot(const ImPlot3DQuat& rhs) const { return x * rhs.x + y * rhs.y + z * rhs.z + w * rhs.w; }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DStream
+//-----------------------------------------------------------------------------
+
+static const int STREAM_CHUNK_SIZE = 1024;
+
+ImPlot3DStream::ImPlot3DStream(int max_size) {
+    MaxSize = max_size;
+    Offset = 0;
+    Version = ImPlot3D::NewSourceVersion();
+    _Bounds = ImPlot3D::ImEmptyBox();
+    _BoundsDirty = false;
+    if (MaxSize > 0)
+        Data.reserve(MaxSize);
+}
+
+void ImPlot3DStream::Append(const ImPlot3DPoint& point) { Append(&point, 1); }
+
+void ImPlot3DStream::Append(const ImPlot3DPoint* points, int count) {
+    Version = ImPlot3D::NewSourceVersion();
+    for (int i = 0; i < count; i++)
+        _Append(points[i]);
+}
+
+void ImPlot3DStream::Append(const float* xs, const float* ys, const float* zs, int count) {
+    Version = ImPlot3D::NewSourceVersion();
+    for (int i = 0; i < count; i++)
+        _Append(ImPlot3DPoint(xs[i], ys[i], zs[i]));
+}
+
+void ImPlot3DStream::_Append(const ImPlot3DPoint& point) {
+    if (MaxSize <= 0 || Data.Size < MaxSize) {
+        // Not full, extend the bounds with the new point
+        int chunk = Data.Size / STREAM_CHUNK_SIZE;
+        Data.push_back(point);
+        if (chunk == _ChunkBounds.Size) {
+            _ChunkBounds.push_back(ImPlot3D::ImEmptyBox());
+            _ChunkDirty.push_back(false);
+        }
+        ImPlot3D::ImExpandBox(_ChunkBounds[chunk], point);
+        if (!_BoundsDirty)
+            ImPlot3D::ImExpandBox(_Bounds, point);
+    } else {
+        // Full, overwrite the oldest point. The bounds of its chunk are recomputed when needed
+        Data[Offset] = point;
+        _ChunkDirty[Offset / STREAM_CHUNK_SIZE] = true;
+        _BoundsDirty = true;
+        Offset = Offset + 1 < Data.Size ? Offset + 1 : 0;
+    }
+}
+
+void ImPlot3DStream::Clear() {
+    Version = ImPlot3D::NewSourceVersion();
+    Data.resize(0);
+    Offset = 0;
+    _ChunkBounds.resize(0);
+    _ChunkDirty.resize(0);
+    _Bounds = ImPlot3D::ImEmptyBox();
+    _BoundsDirty = false;
+}
+
+void ImPlot3DStream::SetMaxSize(int max_size) {
+    Version = ImPlot3D::NewSourceVersion();
+    MaxSize = max_size;
+    int keep = MaxSize > 0 ? ImMin(Data.Size, MaxSize) : Data.Size;
+    if (keep == Data.Size && Offset == 0)
+        return;
+
+    // Keep the newest points, ordered from oldest to newest
+    ImVector<ImPlot3DPoint> data;
+    data.resize(keep);
+    for (int i = 0; i < keep; i++)
+        data[i] = (*this)[Data.Size - keep + i];
+    Data.swap(data);
+    Offset = 0;
+
+    // Recompute the bounds of every chunk when needed
+    int chunk_count = (Data.Size + STREAM_CHUNK_SIZE - 1) / STREAM_CHUNK_SIZE;
+    _ChunkBounds.resize(chunk_count);
+    _ChunkDirty.resize(chunk_count);
+    for (int c = 0; c < chunk_count; c++)
+        _ChunkDirty[c] = true;
+    _BoundsDirty = true;
+}
+
+ImPlot3DBox ImPlot3DStream::GetBounds() const {
+    if (_BoundsDirty) {
+        _Bounds = ImPlot3D::ImEmptyBox();
+        for (int c = 0; c < _ChunkBounds.Size; c++) {
+            if (_ChunkDirty[c]) {
+                ImPlot3DBox& chunk_bounds = _ChunkBounds[c];
+                chunk_bounds = ImPlot3D::ImEmptyBox();
+                int end = ImMin((c + 1) * STREAM_CHUNK_SIZE, Data.Size);
+                for (int i = c * STREAM_CHUNK_SIZE; i < end; i++)
+                    ImPlot3D::ImExpandBox(chunk_bounds, Data[i]);
+                _ChunkDirty[c] = false;
+            }
+            _Bounds.Min.x = ImMin(_Bounds.Min.x, _ChunkBounds[c].Min.x);
+            _Bounds.Min.y = ImMin(_Bounds.Min.y, _ChunkBounds[c].Min.y);
+            _Bounds.Min.z = ImMin(_Bounds.Min.z, _ChunkBounds[c].Min.z);
+            _Bounds.Max.x = ImMax(_Bounds.Max.x, _ChunkBounds[c].Max.x);
+            _Bounds.Max.y = ImMax(_Bounds.Max.y, _ChunkBounds[c].Max.y);
+            _Bounds.Max.z = ImMax(_Bounds.Max.z, _ChunkBounds[c].Max.z);
+        }
+        _BoundsDirty = false;
+    }
+    return _Bounds;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DSPSCBuffer
+//-----------------------------------------------------------------------------
+
+// Counters of a ring, kept out of implot3d.h so the public header does not depend on <atomic>
+struct ImPlot3DSPSCCounters {
+    std::atomic<unsigned int> Head;    // Number of points pushed, written by the producer
+    std::atomic<unsigned int> Tail;    // Number of points consumed, written by the consumer
+    std::atomic<unsigned int> Dropped; // Number of points dropped, written by the producer
+    ImPlot3DSPSCCounters() : Head(0), Tail(0), Dropped(0) {}
+};
+
+ImPlot3DSPSCBuffer::ImPlot3DSPSCBuffer(int capacity, int max_size) : History(max_size) {
+    // Larger rings would overflow the int sizes of ImVector
+    IM_ASSERT_USER_ERROR(capacity > 0 && capacity <= (1 << 24), "Invalid buffer capacity!");
+    unsigned int ring_size = 1;
+    while (ring_size < (unsigned int)capacity)
+        ring_size <<= 1;
+    _Ring.resize((int)ring_size);
+    _Mask = ring_size - 1;
+    _Counters = IM_NEW(ImPlot3DSPSCCounters)();
+}
+
+ImPlot3DSPSCBuffer::~ImPlot3DSPSCBuffer() { IM_DELETE(_Counters); }
+
+int ImPlot3DSPSCBuffer::Pending() const {
+    return (int)(_Counters->Head.load(std::memory_order_acquire) - _Counters->Tail.load(std::memory_order_acquire));
+}
+
+int ImPlot3DSPSCBuffer::Dropped() const { return (int)_Counters->Dropped.load(std::memory_order_relaxed); }
+
+int ImPlot3DSPSCBuffer::Push(const ImPlot3DPoint& point) { return Push(&point, 1); }
+
+int ImPlot3DSPSCBuffer::Push(const ImPlot3DPoint* points, int count) {
+    const unsigned int head = _Counters->Head.load(std::memory_order_relaxed);
+    const unsigned int tail = _Counters->Tail.load(std::memory_order_acquire);
+    const unsigned int free_count = (unsigned int)_Ring.Size - (head - tail);
+    const unsigned int push_count = ImMin((unsigned int)count, free_count);
+    for (unsigned int i = 0; i < push_count; i++)
+        _Ring.Data[(head + i) & _Mask] = points[i];
+    // Publish the points to the consumer
+    _Counters->Head.store(head + push_count, std::memory_order_release);
+    if (push_count < (unsigned int)count)
+        _Counters->Dropped.fetch_add((unsigned int)count - push_count, std::memory_order_relaxed);
+    return (int)push_count;
+}
+
+int ImPlot3DSPSCBuffer::Consume() {
+    const unsigned int tail = _Counters->Tail.load(std::memory_order_relaxed);
+    const unsigned int head = _Counters->Head.load(std::memory_order_acquire);
+    const unsigned int count = head - tail;
+    if (count == 0)
+        return 0;
+    // Append the pending points in at most two contiguous runs
+    const unsigned int begin = tail & _Mask;
+    const unsigned int first_count = ImMin(count, (unsigned int)_Ring.Size - begin);
+    History.Append(_Ring.Data + begin, (int)first_count);
+    if (first_count < count)
+        History.Append(_Ring.Data, (int)(count - first_count));
+    // Release the slots to the producer
+    _Counters->Tail.store(head, std::memory_order_release);
+    return (int)count;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList3D
 //-----------------------------------------------------------------------------
@@ -3211,129 +3821,209 @@ void ImDrawList3D::ResetTexture() { SetTexture(ImTextureID(0)); }
 #endif
 
 void ImDrawList3D::SortedMoveToImGuiDrawList() {
-    ImDrawList& draw_list = *ImGui::GetWindowDrawList();
-
     const int tri_count = ZBuffer.Size;
-    if (tri_count == 0) {
-        // No triangles, just reset buffers and return
-        ResetBuffers();
-        return;
-    }
+    _LastSortedIdxBuffer.resize(IdxBuffer.Size);
+    _LastCmdBuffer.resize(0);
+
+    if (tri_count > 0) {
+        // Build an array of (z, tri_idx)
+        _SortScratch.resize(tri_count);
+        ImDrawTriRef* tris = _SortScratch.Data;
+        for (int i = 0; i < tri_count; i++) {
+            tris[i].Z = ZBuffer[i];
+            tris[i].TriIdx = i;
+        }
 
-    // Build an array of (z, tri_idx)
-    struct TriRef {
-        float z;
-        int tri_idx;
-    };
-    TriRef* tris = (TriRef*)IM_ALLOC(sizeof(TriRef) * tri_count);
-    for (int i = 0; i < tri_count; i++) {
-        tris[i].z = ZBuffer[i];
-        tris[i].tri_idx = i;
+        // Sort by z (distance from viewer)
+        ImQsort(tris, (size_t)tri_count, sizeof(ImDrawTriRef), [](const void* a, const void* b) {
+            float za = ((const ImDrawTriRef*)a)->Z;
+            float zb = ((const ImDrawTriRef*)b)->Z;
+            return (za < zb) ? -1 : (za > zb) ? 1 : 0;
+        });
+
+        // Copy indices with triangle sorting based on distance from viewer, generating one command per texture change
+        const ImTextureRef invalid_tex = ImTextureID(0);
+        ImDrawIdx* idx_out = _LastSortedIdxBuffer.Data;
+        for (int i = 0; i < tri_count; i++) {
+            const ImDrawIdx* idx_in = &IdxBuffer[tris[i].TriIdx * 3];
+            idx_out[0] = idx_in[0];
+            idx_out[1] = idx_in[1];
+            idx_out[2] = idx_in[2];
+            idx_out += 3;
+
+            // Get the texture for this triangle (only if multiple textures were used, e.g. PlotImage was called)
+            ImTextureRef tri_tex = invalid_tex;
+            if (_TextureBuffer.Size > 1)
+                for (int j = 0; j < _TextureBuffer.Size; j++)
+                    if ((unsigned int)idx_in[0] >= _TextureBuffer[j].VtxIdx)
+                        tri_tex = _TextureBuffer[j].TexRef;
+
+            if (_LastCmdBuffer.empty() || _LastCmdBuffer.back().TexRef != tri_tex)
+                _LastCmdBuffer.push_back({tri_tex, 0});
+            _LastCmdBuffer.back().ElemCount += 3;
+        }
     }
 
-    // Sort by z (distance from viewer)
-    ImQsort(tris, (size_t)tri_count, sizeof(TriRef), [](const void* a, const void* b) {
-        float za = ((const TriRef*)a)->z;
-        float zb = ((const TriRef*)b)->z;
-        return (za < zb) ? -1 : (za > zb) ? 1 : 0;
-    });
+    // Keep the unsorted buffers, they are used to restore items when the last output is only partially reused
+    IdxBuffer.swap(_LastIdxBuffer);
+    VtxBuffer.swap(_LastVtxBuffer);
+    ZBuffer.swap(_LastZBuffer);
+    _TextureBuffer.swap(_LastTextureBuffer);
+    ResetBuffers();
+
+    AppendLastToImGuiDrawList();
+}
+
+void ImDrawList3D::AppendLastToImGuiDrawList() {
+    if (_LastSortedIdxBuffer.empty())
+        return;
+
+    ImDrawList& draw_list = *ImGui::GetWindowDrawList();
 
     // Reserve space in the ImGui draw list
-    draw_list.PrimReserve(IdxBuffer.Size, VtxBuffer.Size);
+    draw_list.PrimReserve(_LastSortedIdxBuffer.Size, _LastVtxBuffer.Size);
 
     // Copy vertices (no reordering needed)
-    memcpy(draw_list._VtxWritePtr, VtxBuffer.Data, VtxBuffer.Size * sizeof(ImDrawVert));
+    memcpy(draw_list._VtxWritePtr, _LastVtxBuffer.Data, _LastVtxBuffer.Size * sizeof(ImDrawVert));
     unsigned int idx_offset = draw_list._VtxCurrentIdx;
-    draw_list._VtxWritePtr += VtxBuffer.Size;
-    draw_list._VtxCurrentIdx += (unsigned int)VtxBuffer.Size;
+    draw_list._VtxWritePtr += _LastVtxBuffer.Size;
+    draw_list._VtxCurrentIdx += (unsigned int)_LastVtxBuffer.Size;
 
     // Maximum index allowed to not overflow ImDrawIdx
     unsigned int max_index_allowed = MaxIdx() - idx_offset;
 
-    // Copy indices with triangle sorting based on distance from viewer
-    ImDrawIdx* idx_out_begin = draw_list._IdxWritePtr;
-    ImDrawIdx* idx_out = idx_out_begin;
-    ImDrawIdx* idx_in = IdxBuffer.Data;
-    for (int i = 0; i < tri_count; i++) {
-        int tri_i = tris[i].tri_idx;
-        int base_idx = tri_i * 3;
-        unsigned int i0 = (unsigned int)idx_in[base_idx + 0];
-        unsigned int i1 = (unsigned int)idx_in[base_idx + 1];
-        unsigned int i2 = (unsigned int)idx_in[base_idx + 2];
-
-        // Check if after adding offset any of these indices exceed max_index_allowed
-        if (i0 > max_index_allowed || i1 > max_index_allowed || i2 > max_index_allowed)
-            continue;
+    // Remove elements reserved from PrimReserve, they are added back for each command
+    draw_list.CmdBuffer.back().ElemCount -= _LastSortedIdxBuffer.Size;
+
+    ImTextureRef default_tex = GET_TEX_REF(draw_list._CmdHeader);
+    ImTextureRef curr_tex = default_tex;
+    const ImTextureRef invalid_tex = ImTextureID(0);
+    const ImDrawIdx* idx_in = _LastSortedIdxBuffer.Data;
+    ImDrawIdx* idx_out = draw_list._IdxWritePtr;
+    for (int c = 0; c < _LastCmdBuffer.Size; c++) {
+        const ImDrawCmd3D& cmd = _LastCmdBuffer[c];
+
+        // If the texture is invalid, the default texture should be used
+        ImTextureRef cmd_tex = cmd.TexRef == invalid_tex ? default_tex : cmd.TexRef;
+        if (cmd_tex != curr_tex) {
+            // Set custom texture
+            curr_tex = cmd_tex;
+            SET_TEX_REF(draw_list._CmdHeader, curr_tex);
+
+            // Add new draw cmd for the new texture
+            ImDrawCmd draw_cmd;
+            draw_cmd.ClipRect = draw_list._CmdHeader.ClipRect;
+            SET_TEX_REF(draw_cmd, GET_TEX_REF(draw_list._CmdHeader));
+            draw_cmd.VtxOffset = draw_list._CmdHeader.VtxOffset;
+            draw_cmd.IdxOffset = (unsigned int)(idx_out - draw_list.IdxBuffer.Data);
+            draw_list.CmdBuffer.push_back(draw_cmd);
+        }
 
-        idx_out[0] = (ImDrawIdx)(i0 + idx_offset);
-        idx_out[1] = (ImDrawIdx)(i1 + idx_offset);
-        idx_out[2] = (ImDrawIdx)(i2 + idx_offset);
+        ImDrawIdx* idx_out_begin = idx_out;
+        for (unsigned int i = 0; i < cmd.ElemCount; i += 3, idx_in += 3) {
+            unsigned int i0 = (unsigned int)idx_in[0];
+            unsigned int i1 = (unsigned int)idx_in[1];
+            unsigned int i2 = (unsigned int)idx_in[2];
+
+            // Check if after adding offset any of these indices exceed max_index_allowed
+            if (i0 > max_index_allowed || i1 > max_index_allowed || i2 > max_index_allowed)
+                continue;
 
-        idx_out += 3;
+            idx_out[0] = (ImDrawIdx)(i0 + idx_offset);
+            idx_out[1] = (ImDrawIdx)(i1 + idx_offset);
+            idx_out[2] = (ImDrawIdx)(i2 + idx_offset);
+            idx_out += 3;
+        }
+        draw_list.CmdBuffer.back().ElemCount += (unsigned int)(idx_out - idx_out_begin);
     }
-    ImDrawIdx* idx_out_end = idx_out;
-    draw_list._IdxWritePtr = idx_out_end;
 
-    // If multiple textures were used (e.g. PlotImage was called), generate multiple ImDrawCmd
-    if (_TextureBuffer.Size > 1) {
-        ImTextureRef default_tex = GET_TEX_REF(draw_list._CmdHeader);
-        ImTextureRef curr_tex = default_tex;
+    // Give back the indices of the triangles that were skipped
+    draw_list.IdxBuffer.shrink((int)(idx_out - draw_list.IdxBuffer.Data));
+    draw_list._IdxWritePtr = idx_out;
 
-        // Remove elements reserved from PrimReserve
-        draw_list.CmdBuffer.back().ElemCount -= IdxBuffer.Size;
-        ImDrawIdx* last_cmd_buffer_idx = idx_out_begin;
+    // Check if the last texture was not the default texture
+    if (curr_tex != default_tex) {
+        // Restore default texture
+        SET_TEX_REF(draw_list._CmdHeader, default_tex);
 
-        // For each triangle added to the draw_list
-        for (idx_out = idx_out_begin; idx_out < idx_out_end; idx_out += 3) {
-            // Get index of first vertex in the triangle
-            unsigned int idx_in = (unsigned int)(*idx_out - idx_offset);
+        // Flush last draw cmd with custom texture
+        draw_list.AddDrawCmd();
+    }
+}
 
-            // Get the texture for this triangle
-            const ImTextureRef invalid_tex = ImTextureID(0);
-            ImTextureRef tri_tex = invalid_tex;
-            for (int j = 0; j < _TextureBuffer.Size; j++)
-                if (idx_in >= _TextureBuffer[j].VtxIdx)
-                    tri_tex = _TextureBuffer[j].TexRef;
-
-            // If tri_tex is invalid, the default texture should be used
-            if (tri_tex == invalid_tex)
-                tri_tex = default_tex;
-
-            if (tri_tex != curr_tex) {
-                // Update element count of previous draw cmd
-                draw_list.CmdBuffer.back().ElemCount += (unsigned int)(idx_out - last_cmd_buffer_idx);
-                last_cmd_buffer_idx = idx_out;
-
-                // Set custom texture
-                curr_tex = tri_tex;
-                SET_TEX_REF(draw_list._CmdHeader, curr_tex);
-
-                // Add new draw cmd for the new texture
-                ImDrawCmd draw_cmd;
-                draw_cmd.ClipRect = draw_list._CmdHeader.ClipRect;
-                SET_TEX_REF(draw_cmd, GET_TEX_REF(draw_list._CmdHeader));
-                draw_cmd.VtxOffset = draw_list._CmdHeader.VtxOffset;
-                draw_cmd.IdxOffset = (unsigned int)(idx_out - draw_list.IdxBuffer.Data);
-                draw_list.CmdBuffer.push_back(draw_cmd);
-            }
-        }
-        // Flush last elements to cmd buffer
-        draw_list.CmdBuffer.back().ElemCount += (unsigned int)(&draw_list.IdxBuffer.back() - last_cmd_buffer_idx + 1);
+void ImDrawList3D::RestoreLast(int vtx_count, int idx_count) {
+    IM_ASSERT(VtxBuffer.empty() && IdxBuffer.empty());
+    IM_ASSERT(vtx_count <= _LastVtxBuffer.Size && idx_count <= _LastIdxBuffer.Size);
 
-        // Check if the last texture was not the default texture
-        if (curr_tex != default_tex) {
-            // Restore default texture
-            SET_TEX_REF(draw_list._CmdHeader, default_tex);
+    PrimReserve(idx_count, vtx_count);
+    memcpy(_VtxWritePtr, _LastVtxBuffer.Data, vtx_count * sizeof(ImDrawVert));
+    memcpy(_IdxWritePtr, _LastIdxBuffer.Data, idx_count * sizeof(ImDrawIdx));
+    memcpy(_ZWritePtr, _LastZBuffer.Data, (idx_count / 3) * sizeof(float));
+    _VtxWritePtr += vtx_count;
+    _IdxWritePtr += idx_count;
+    _ZWritePtr += idx_count / 3;
+    _VtxCurrentIdx = (unsigned int)vtx_count;
 
-            // Flush last draw cmd with custom texture
-            draw_list.AddDrawCmd();
-        }
-    }
+    // Restore the textures used by the restored vertices
+    _TextureBuffer.resize(0);
+    for (int i = 0; i < _LastTextureBuffer.Size && _LastTextureBuffer[i].VtxIdx < (unsigned int)vtx_count; i++)
+        _TextureBuffer.push_back(_LastTextureBuffer[i]);
+    ResetTexture();
+}
 
-    // Reset buffers since we've moved them
-    ResetBuffers();
+// Reallocates the vector with a smaller capacity, keeping its content
+template <typename T> static void TrimVector(ImVector<T>& v, int capacity) {
+    capacity = ImMax(capacity, v.Size);
+    if (v.Capacity <= capacity)
+        return;
+    ImVector<T> trimmed;
+    trimmed.reserve(capacity);
+    trimmed.resize(v.Size);
+    if (v.Size > 0)
+        memcpy(trimmed.Data, v.Data, (size_t)v.Size * sizeof(T));
+    v.swap(trimmed);
+}
+
+void ImDrawList3D::TrimUnused(int frame_count, float fraction) {
+    // The last output holds what was used this frame, the working buffers are empty and only keep their capacity
+    IM_ASSERT(VtxBuffer.empty() && IdxBuffer.empty());
+    const int used_vtx = _LastVtxBuffer.Size;
+    const int used_idx = _LastIdxBuffer.Size;
+    const int capacity_vtx = ImMax(VtxBuffer.Capacity, _LastVtxBuffer.Capacity);
+    const int capacity_idx = ImMax(IdxBuffer.Capacity, _LastIdxBuffer.Capacity);
+    const int min_capacity_vtx = 4096; // Not worth trimming below this
+    if (frame_count <= 0 || capacity_vtx <= min_capacity_vtx || used_vtx >= capacity_vtx * fraction || used_idx >= capacity_idx * fraction) {
+        _TrimFrameCount = _TrimPeakVtx = _TrimPeakIdx = 0;
+        return;
+    }
+    _TrimPeakVtx = ImMax(_TrimPeakVtx, used_vtx);
+    _TrimPeakIdx = ImMax(_TrimPeakIdx, used_idx);
+    if (++_TrimFrameCount < frame_count)
+        return;
 
-    IM_FREE(tris);
+    // Keep room for the largest frame seen while the buffers were mostly unused
+    const int vtx_count = _TrimPeakVtx;
+    const int idx_count = _TrimPeakIdx;
+    TrimVector(VtxBuffer, vtx_count);
+    TrimVector(IdxBuffer, idx_count);
+    TrimVector(ZBuffer, idx_count / 3);
+    TrimVector(_LastVtxBuffer, vtx_count);
+    TrimVector(_LastIdxBuffer, idx_count);
+    TrimVector(_LastZBuffer, idx_count / 3);
+    TrimVector(_LastSortedIdxBuffer, idx_count);
+    TrimVector(_SortScratch, idx_count / 3);
+    _VtxWritePtr = VtxBuffer.Data;
+    _IdxWritePtr = IdxBuffer.Data;
+    _ZWritePtr = ZBuffer.Data;
+    _TrimFrameCount = _TrimPeakVtx = _TrimPeakIdx = 0;
+}
+
+size_t ImDrawList3D::CalcMemoryUsage() const {
+    return (size_t)(IdxBuffer.Capacity + _LastIdxBuffer.Capacity + _LastSortedIdxBuffer.Capacity) * sizeof(ImDrawIdx) +
+           (size_t)(VtxBuffer.Capacity + _LastVtxBuffer.Capacity) * sizeof(ImDrawVert) +
+           (size_t)(ZBuffer.Capacity + _LastZBuffer.Capacity) * sizeof(float) +
+           (size_t)(_TextureBuffer.Capacity + _LastTextureBuffer.Capacity) * sizeof(ImTextureBufferItem) +
+           (size_t)_LastCmdBuffer.Capacity * sizeof(ImDrawCmd3D) + (size_t)_SortScratch.Capacity * sizeof(ImDrawTriRef);
 }
 
 //-----------------------------------------------------------------------------
@@ -3365,6 +4055,70 @@ void ImPlot3DAxis::ApplyFit() {
     FitExtents.Max = -HUGE_VAL;
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DItemGroup
+//-----------------------------------------------------------------------------
+
+void ImPlot3DItemGroup::SetItemLabel(ImPlot3DItem* item, const char* label_id) {
+    if (item->NameOffset != -1)
+        Legend.LabelsGarbage += (int)strlen(Legend.Labels.Buf.Data + item->NameOffset) + 1;
+    item->NameOffset = Legend.Labels.size();
+    Legend.Labels.append(label_id, label_id + strlen(label_id) + 1);
+    item->NameWidth = -1.0f;
+    item->NameShown = ImGui::FindRenderedTextEnd(label_id, nullptr) != label_id;
+}
+
+void ImPlot3DItemGroup::CompactLabels() {
+    // Labels that change every frame (e.g. "Value: %d###Value") leave their previous versions behind
+    if (Legend.LabelsGarbage <= 1024 || Legend.LabelsGarbage < Legend.Labels.size() / 2)
+        return;
+    ImGuiTextBuffer& labels = Legend.LabelsScratch;
+    labels.Buf.shrink(0);
+    for (int i = 0; i < ItemPool.GetBufSize(); i++) {
+        ImPlot3DItem* item = ItemPool.GetByIndex(i);
+        if (item->NameOffset == -1)
+            continue;
+        const char* label = Legend.Labels.Buf.Data + item->NameOffset;
+        item->NameOffset = labels.size();
+        labels.append(label, label + strlen(label) + 1);
+    }
+    Legend.Labels.Buf.swap(labels.Buf);
+    Legend.LabelsGarbage = 0;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DTextCache
+//-----------------------------------------------------------------------------
+
+void ImPlot3DTextCache::GarbageCollect() {
+    // Labels change as the axes move, so compact once the stale entries outweigh the used ones
+    if (Vtx.Size > 2 * UsedVtxCount + 1024) {
+        // Compact in place (entries are ordered by vertex offset), keeping the capacity for the next labels
+        int frame = ImGui::GetFrameCount();
+        int entry_count = 0;
+        int text_size = 0;
+        int vtx_count = 0;
+        Map.Data.resize(0);
+        for (int i = 0; i < Entries.Size; i++) {
+            Entry entry = Entries[i];
+            if (entry.LastFrame != frame)
+                continue;
+            memmove(Text.Data + text_size, Text.Data + entry.TextOffset, entry.TextLength);
+            entry.TextOffset = text_size;
+            text_size += entry.TextLength;
+            memmove(Vtx.Data + vtx_count, Vtx.Data + entry.VtxOffset, entry.VtxCount * sizeof(ImDrawVert));
+            entry.VtxOffset = vtx_count;
+            vtx_count += entry.VtxCount;
+            Entries[entry_count++] = entry;
+            Map.SetInt(entry.Key, entry_count);
+        }
+        Entries.shrink(entry_count);
+        Text.shrink(text_size);
+        Vtx.shrink(vtx_count);
+    }
+    UsedVtxCount = 0;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImPlot3DPlot
 //-----------------------------------------------------------------------------
@@ -3393,6 +4147,41 @@ void ImPlot3DPlot::SetRange(const ImPlot3DPoint& min, const ImPlot3DPoint& max)
 
 float ImPlot3DPlot::GetBoxZoom() const { return ImMin(PlotRect.GetWidth(), PlotRect.GetHeight()) / 1.8f; }
 
+ImGuiID ImPlot3DPlot::CalcViewHash() const {
+    ImGuiID hash = ImHashData(&Rotation, sizeof(ImPlot3DQuat));
+    for (int i = 0; i < 3; i++) {
+        hash = ImHashData(&Axes[i].Range, sizeof(ImPlot3DRange), hash);
+        hash = ImHashData(&Axes[i].Flags, sizeof(ImPlot3DAxisFlags), hash);
+    }
+    hash = ImHashData(&Flags, sizeof(ImPlot3DFlags), hash);
+    hash = ImHashData(&PlotRect, sizeof(ImRect), hash);
+    hash = ImHashData(&BoxScale, sizeof(ImPlot3DPoint), hash);
+    hash = ImHashData(&DrawList._Flags, sizeof(ImDrawListFlags), hash);
+    hash = ImHashData(&DrawList._SharedData, sizeof(ImDrawListSharedData*), hash);
+    if (DrawList._SharedData != nullptr) {
+        hash = ImHashData(&DrawList._SharedData->TexUvWhitePixel, sizeof(ImVec2), hash);
+        hash = ImHashData(&DrawList._SharedData->TexUvLines, sizeof(ImVec4*), hash);
+    }
+    hash = ImHashData(&ImGui::GetStyle().Alpha, sizeof(float), hash);
+    return hash;
+}
+
+void ImPlot3DPlot::RestoreLastOutput(int item_count) {
+    // Copy the triangles of the first item_count items of the last output back into the draw list
+    bool all_items = item_count >= LastItemOutputs.Size;
+    int vtx_count = all_items ? DrawList._LastVtxBuffer.Size : LastItemOutputs[item_count].VtxOffset;
+    int idx_count = all_items ? DrawList._LastIdxBuffer.Size : LastItemOutputs[item_count].IdxOffset;
+    DrawList.RestoreLast(vtx_count, idx_count);
+    ReusingOutput = false;
+}
+
+size_t ImPlot3DPlot::CalcMemoryUsage() const {
+    return DrawList.CalcMemoryUsage() + (size_t)TextCache.Vtx.Capacity * sizeof(ImDrawVert) +
+           (size_t)TextCache.Entries.Capacity * sizeof(ImPlot3DTextCache::Entry) + (size_t)TextCache.Text.Capacity +
+           (size_t)TextCache.Map.Data.Capacity * sizeof(TextCache.Map.Data[0]) +
+           (size_t)(ItemOutputs.Capacity + LastItemOutputs.Capacity) * sizeof(ImPlot3DItemOutput);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImPlot3DStyle
 //-----------------------------------------------------------------------------
@@ -3478,6 +4267,19 @@ void ImPlot3D::ShowMetricsWindow(bool* p_popen) {
         ImGui::Checkbox("Show Axis Face Indexes", &show_axis_face_indexes);
         ImGui::Checkbox("Show Axis Edge Indexes", &show_axis_edge_indexes);
         ImGui::Checkbox("Show Legend Rects", &show_legend_rects);
+        // Steady frames should not allocate once every plot reached its largest size
+        static bool count_allocations = false;
+        static int last_allocation_count = 0;
+        if (ImGui::Checkbox("Count Allocations", &count_allocations)) {
+            SetAllocationCounting(count_allocations);
+            last_allocation_count = 0;
+        }
+        if (count_allocations) {
+            int allocation_count = GetAllocationCount();
+            ImGui::SameLine();
+            ImGui::Text("%d allocations since last frame", allocation_count - last_allocation_count);
+            last_allocation_count = allocation_count;
+        }
         ImGui::TreePop();
     }
     const int n_plots = gp.Plots.GetBufSize();
@@ -3673,6 +4475,8 @@ void ImPlot3D::ShowMetricsWindow(bool* p_popen) {
                 }
 
                 ImGui::BulletText("Title: %s", plot.HasTitle() ? plot.GetTitle() : "none");
+                ImGui::BulletText("Memory: %.1f KB (draw list: %.1f KB, %d vertices)", plot.CalcMemoryUsage() / 1024.0,
+                                  plot.DrawList.CalcMemoryUsage() / 1024.0, plot.DrawList._LastVtxBuffer.Size);
                 ImGui::BulletText("Flags: 0x%08X", plot.Flags);
                 ImGui::BulletText("Initialized: %s", plot.Initialized ? "true" : "false");
                 ImGui::BulletText("Hovered: %s", plot.Hovered ? "true" : "false");
@@ -3698,6 +4502,69 @@ void ImPlot3D::ShowMetricsWindow(bool* p_popen) {
         ImGui::TreePop();
     }
 
+    if (ImGui::TreeNode("Mesh LODs", "Mesh LODs (%d)", gp.MeshLODs.GetAliveCount())) {
+        for (int i = 0; i < gp.MeshLODs.GetMapSize(); i++) {
+            const ImPlot3DMeshLOD* lod = gp.MeshLODs.TryGetMapData(i);
+            if (lod == nullptr)
+                continue;
+            ImGui::BulletText("Mesh [0x%08X]: %d levels, %.1f KB, last used %d frames ago", lod->Key, lod->Levels.Size,
+                              lod->Indices.size_in_bytes() / 1024.0, ImGui::GetFrameCount() - lod->LastFrame);
+            ImGui::Indent();
+            for (int l = 0; l < lod->Levels.Size; l++)
+                ImGui::BulletText("Level %d: %d triangles", l, lod->Levels[l].IdxCount / 3);
+            ImGui::Unindent();
+        }
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("Meshes", "Meshes (%d)", gp.Meshes.GetAliveCount())) {
+        for (int i = 0; i < gp.Meshes.GetMapSize(); i++) {
+            const ImPlot3DMesh* mesh = gp.Meshes.TryGetMapData(i);
+            if (mesh == nullptr)
+                continue;
+            int open_edges = 0;
+            for (int a : mesh->Adjacency)
+                open_edges += a == -1;
+            ImGui::BulletText("Mesh %u: %d vertices, %d triangles, %d edges (%d open), version %llu", mesh->ID, mesh->Vertices.Size,
+                              mesh->Indices.Size / 3, mesh->Edges.Size / 2, open_edges, (unsigned long long)mesh->Version);
+        }
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("Isosurfaces", "Isosurfaces (%d)", gp.Isosurfaces.GetAliveCount())) {
+        for (int i = 0; i < gp.Isosurfaces.GetMapSize(); i++) {
+            const ImPlot3DIsosurface* iso = gp.Isosurfaces.TryGetMapData(i);
+            if (iso == nullptr)
+                continue;
+            ImGui::BulletText("Isosurface [0x%08X]: iso %g, %d vertices, %d triangles, extracted %llu times, last used %d frames ago", iso->Key,
+                              iso->Iso, iso->Vertices.Size, iso->Indices.Size / 3, (unsigned long long)iso->Version,
+                              ImGui::GetFrameCount() - iso->LastFrame);
+        }
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("Voxels", "Voxels (%d)", gp.Voxels.GetAliveCount())) {
+        for (int i = 0; i < gp.Voxels.GetMapSize(); i++) {
+            const ImPlot3DVoxels* voxels = gp.Voxels.TryGetMapData(i);
+            if (voxels == nullptr)
+                continue;
+            ImGui::BulletText("Voxels [0x%08X]: %d merged faces, extracted %llu times, last used %d frames ago", voxels->Key,
+                              voxels->FaceOffsets[6], (unsigned long long)voxels->Version, ImGui::GetFrameCount() - voxels->LastFrame);
+        }
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("Normals", "Normals (%d)", gp.Normals.GetAliveCount())) {
+        for (int i = 0; i < gp.Normals.GetMapSize(); i++) {
+            const ImPlot3DNormals* normals = gp.Normals.TryGetMapData(i);
+            if (normals == nullptr)
+                continue;
+            ImGui::BulletText("Normals [0x%08X]: %d vertices, last used %d frames ago", normals->Key, normals->Normals.Size,
+                              ImGui::GetFrameCount() - normals->LastFrame);
+        }
+        ImGui::TreePop();
+    }
+
     if (ImGui::TreeNode("Colormaps")) {
         ImGui::BulletText("Colormaps:  %d", gp.ColormapData.Count);
         ImGui::BulletText("Memory: %d bytes", gp.ColormapData.Tables.Size * (int)(sizeof(gp.ColormapData.Tables.Data[0])));
@@ -30,11 +30,16 @@
 // [SECTION] ImPlot3DPlane
 // [SECTION] ImPlot3DBox
 // [SECTION] ImPlot3DQuat
+// [SECTION] ImPlot3DVector
+// [SECTION] ImPlot3DStream
+// [SECTION] ImPlot3DSPSCBuffer
+// [SECTION] ImPlot3DCommandList
 // [SECTION] ImPlot3DStyle
 // [SECTION] Meshes
 
 #pragma once
 #include "imgui.h"
+#include <stdlib.h> // malloc, free (ImPlot3DVector)
 #ifndef IMGUI_DISABLE
 
 //-----------------------------------------------------------------------------
@@ -51,6 +56,11 @@
 #define IMPLOT3D_AUTO_COL ImVec4(0, 0, 0, -1) // Deduce color automatically
 #define IMPLOT3D_TMP template <typename T> IMPLOT3D_API
 
+// Compile-time options:
+// - IMPLOT3D_THREAD_LOCAL_CONTEXT: make the current context thread_local, so independent plots can be built concurrently from several threads,
+//   each with its own ImGuiContext/ImPlot3DContext (ImGui needs the same, e.g. by redirecting GImGui to a thread_local in imconfig.h)
+// - IMPLOT3D_DISABLE_THREADS: never spawn threads (large items are only tessellated in parallel through SetParallelFor)
+
 //-----------------------------------------------------------------------------
 // [SECTION] Forward declarations and basic types
 //-----------------------------------------------------------------------------
@@ -64,6 +74,9 @@ struct ImPlot3DPlane;
 struct ImPlot3DBox;
 struct ImPlot3DRange;
 struct ImPlot3DQuat;
+struct ImPlot3DStream;
+struct ImPlot3DSPSCBuffer;
+struct ImPlot3DCommandList;
 
 // Enums
 typedef int ImPlot3DCond;     // -> ImPlot3DCond_              // Enum: Condition for flags
@@ -76,17 +89,20 @@ typedef int ImPlane3D;        // -> ImPlane3D_                  // Enum: Plane i
 typedef int ImPlot3DColormap; // -> ImPlot3DColormap_          // Enum: Colormaps
 
 // Flags
-typedef int ImPlot3DFlags;         // -> ImPlot3DFlags_         // Flags: for BeginPlot()
-typedef int ImPlot3DItemFlags;     // -> ImPlot3DItemFlags_     // Flags: Item flags
-typedef int ImPlot3DScatterFlags;  // -> ImPlot3DScatterFlags_  // Flags: Scatter plot flags
-typedef int ImPlot3DLineFlags;     // -> ImPlot3DLineFlags_     // Flags: Line plot flags
-typedef int ImPlot3DTriangleFlags; // -> ImPlot3DTriangleFlags_ // Flags: Triangle plot flags
-typedef int ImPlot3DQuadFlags;     // -> ImPlot3DQuadFlags_     // Flags: QuadFplot flags
-typedef int ImPlot3DSurfaceFlags;  // -> ImPlot3DSurfaceFlags_  // Flags: Surface plot flags
-typedef int ImPlot3DMeshFlags;     // -> ImPlot3DMeshFlags_     // Flags: Mesh plot flags
-typedef int ImPlot3DImageFlags;    // -> ImPlot3DImageFlags_    // Flags: Image plot flags
-typedef int ImPlot3DLegendFlags;   // -> ImPlot3DLegendFlags_   // Flags: Legend flags
-typedef int ImPlot3DAxisFlags;     // -> ImPlot3DAxisFlags_     // Flags: Axis flags
+typedef int ImPlot3DFlags;           // -> ImPlot3DFlags_           // Flags: for BeginPlot()
+typedef int ImPlot3DItemFlags;       // -> ImPlot3DItemFlags_       // Flags: Item flags
+typedef int ImPlot3DScatterFlags;    // -> ImPlot3DScatterFlags_    // Flags: Scatter plot flags
+typedef int ImPlot3DLineFlags;       // -> ImPlot3DLineFlags_       // Flags: Line plot flags
+typedef int ImPlot3DTriangleFlags;   // -> ImPlot3DTriangleFlags_   // Flags: Triangle plot flags
+typedef int ImPlot3DQuadFlags;       // -> ImPlot3DQuadFlags_       // Flags: QuadFplot flags
+typedef int ImPlot3DSurfaceFlags;    // -> ImPlot3DSurfaceFlags_    // Flags: Surface plot flags
+typedef int ImPlot3DMeshFlags;       // -> ImPlot3DMeshFlags_       // Flags: Mesh plot flags
+typedef int ImPlot3DCreateMeshFlags; // -> ImPlot3DCreateMeshFlags_ // Flags: Mesh creation flags
+typedef int ImPlot3DIsosurfaceFlags; // -> ImPlot3DIsosurfaceFlags_ // Flags: Isosurface plot flags
+typedef int ImPlot3DVoxelsFlags;     // -> ImPlot3DVoxelsFlags_     // Flags: Voxels plot flags
+typedef int ImPlot3DImageFlags;      // -> ImPlot3DImageFlags_      // Flags: Image plot flags
+typedef int ImPlot3DLegendFlags;     // -> ImPlot3DLegendFlags_     // Flags: Legend flags
+typedef int ImPlot3DAxisFlags;       // -> ImPlot3DAxisFlags_       // Flags: Axis flags
 
 // Fallback for ImGui versions before v1.92: define ImTextureRef as ImTextureID
 // You can `#define IMPLOT3D_NO_IMTEXTUREREF` to avoid this fallback
@@ -94,6 +110,22 @@ typedef int ImPlot3DAxisFlags;     // -> ImPlot3DAxisFlags_     // Flags: Axis f
 typedef ImTextureID ImTextureRef;
 #endif
 
+// Handle of a plot item, returned by GetItemHandle(). Submitting an item through its handle skips hashing and copying its label
+struct ImPlot3DItemHandle {
+    ImGuiID ID; // Item ID (0 if invalid)
+    int Index;  // Index of the item in its plot, checked against ID before use
+    ImPlot3DItemHandle() {
+        ID = 0;
+        Index = -1;
+    }
+};
+
+// Handle of a mesh registered with CreateMesh()
+struct ImPlot3DMeshHandle {
+    ImGuiID ID; // Mesh ID (0 if invalid)
+    ImPlot3DMeshHandle() { ID = 0; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Flags & Enumerations
 //-----------------------------------------------------------------------------
@@ -186,6 +218,7 @@ enum ImPlot3DScatterFlags_ {
     ImPlot3DScatterFlags_None = 0, // Default
     ImPlot3DScatterFlags_NoLegend = ImPlot3DItemFlags_NoLegend,
     ImPlot3DScatterFlags_NoFit = ImPlot3DItemFlags_NoFit,
+    ImPlot3DScatterFlags_Fade = 1 << 10, // The alpha fades in from the first point to the last one (e.g. for trails)
 };
 
 // Flags for PlotLine
@@ -196,6 +229,7 @@ enum ImPlot3DLineFlags_ {
     ImPlot3DLineFlags_Segments = 1 << 10, // A line segment will be rendered from every two consecutive points
     ImPlot3DLineFlags_Loop = 1 << 11,     // The last and first point will be connected to form a closed loop
     ImPlot3DLineFlags_SkipNaN = 1 << 12,  // NaNs values will be skipped instead of rendered as missing data
+    ImPlot3DLineFlags_Fade = 1 << 13,     // The alpha fades in from the first point to the last one (e.g. for trails)
 };
 
 // Flags for PlotTriangle
@@ -226,6 +260,7 @@ enum ImPlot3DSurfaceFlags_ {
     ImPlot3DSurfaceFlags_NoLines = 1 << 10,   // No lines will be rendered
     ImPlot3DSurfaceFlags_NoFill = 1 << 11,    // No fill will be rendered
     ImPlot3DSurfaceFlags_NoMarkers = 1 << 12, // No markers will be rendered
+    ImPlot3DSurfaceFlags_Shaded = 1 << 13,    // The fill is shaded by a light fixed relative to the camera, to show the shape of the surface
 };
 
 // Flags for PlotMesh
@@ -236,6 +271,36 @@ enum ImPlot3DMeshFlags_ {
     ImPlot3DMeshFlags_NoLines = 1 << 10,   // No lines will be rendered
     ImPlot3DMeshFlags_NoFill = 1 << 11,    // No fill will be rendered
     ImPlot3DMeshFlags_NoMarkers = 1 << 12, // No markers will be rendered
+    ImPlot3DMeshFlags_LOD = 1 << 13,       // Large meshes are rendered with a simplified level matching their size in pixels
+    ImPlot3DMeshFlags_Shaded = 1 << 14,    // The fill is shaded by a light fixed relative to the camera, to show the shape of the mesh
+};
+
+// Flags for CreateMesh
+enum ImPlot3DCreateMeshFlags_ {
+    ImPlot3DCreateMeshFlags_None = 0,      // Default
+    ImPlot3DCreateMeshFlags_Weld = 1 << 0, // Merge vertices with identical positions (e.g. one vertex per triangle corner) so triangles share edges
+};
+
+// Flags for PlotIsosurface
+enum ImPlot3DIsosurfaceFlags_ {
+    ImPlot3DIsosurfaceFlags_None = 0, // Default
+    ImPlot3DIsosurfaceFlags_NoLegend = ImPlot3DItemFlags_NoLegend,
+    ImPlot3DIsosurfaceFlags_NoFit = ImPlot3DItemFlags_NoFit,
+    ImPlot3DIsosurfaceFlags_NoLines = 1 << 10,   // No lines will be rendered
+    ImPlot3DIsosurfaceFlags_NoFill = 1 << 11,    // No fill will be rendered
+    ImPlot3DIsosurfaceFlags_NoMarkers = 1 << 12, // No markers will be rendered
+    ImPlot3DIsosurfaceFlags_Shaded = 1 << 13,    // The fill is shaded by a light fixed relative to the camera, to show the shape of the surface
+};
+
+// Flags for PlotVoxels
+enum ImPlot3DVoxelsFlags_ {
+    ImPlot3DVoxelsFlags_None = 0, // Default
+    ImPlot3DVoxelsFlags_NoLegend = ImPlot3DItemFlags_NoLegend,
+    ImPlot3DVoxelsFlags_NoFit = ImPlot3DItemFlags_NoFit,
+    ImPlot3DVoxelsFlags_NoLines = 1 << 10,   // No lines will be rendered
+    ImPlot3DVoxelsFlags_NoFill = 1 << 11,    // No fill will be rendered
+    ImPlot3DVoxelsFlags_NoCulling = 1 << 12, // Render the faces pointing away from the camera too (e.g. with a translucent fill)
+    ImPlot3DVoxelsFlags_Shaded = 1 << 13,    // The faces are shaded by a light fixed relative to the camera, to tell the directions apart
 };
 
 // Flags for PlotImage
@@ -325,6 +390,13 @@ enum ImPlot3DColormap_ {
 // Callback signature for axis tick label formatter
 typedef int (*ImPlot3DFormatter)(float value, char* buff, int size, void* user_data);
 
+// Callback signature for a job run by ImPlot3DParallelFor, called once for each index
+typedef void (*ImPlot3DJob)(int index, void* job_data);
+
+// Callback signature for a parallel for. Must call job(i, job_data) for each i in [0, count), possibly from several threads at the same time,
+// and return once all calls returned
+typedef void (*ImPlot3DParallelFor)(int count, ImPlot3DJob job, void* job_data, void* user_data);
+
 namespace ImPlot3D {
 
 //-----------------------------------------------------------------------------
@@ -335,6 +407,16 @@ IMPLOT3D_API void DestroyContext(ImPlot3DContext* ctx = nullptr);
 IMPLOT3D_API ImPlot3DContext* GetCurrentContext();
 IMPLOT3D_API void SetCurrentContext(ImPlot3DContext* ctx);
 
+// Sets the parallel for used to tessellate large items on several threads (e.g. to forward the jobs to your own job system). When nullptr,
+// ImPlot3D runs the jobs on std::thread workers started once per context and kept until it is destroyed, or on the calling thread if
+// IMPLOT3D_DISABLE_THREADS is defined. max_jobs is the maximum number of jobs an item is split into (0: number of hardware threads, 1: always
+// tessellate on the calling thread)
+IMPLOT3D_API void SetParallelFor(ImPlot3DParallelFor parallel_for, void* user_data = nullptr, int max_jobs = 0);
+
+// Sets when the buffers of a plot are trimmed. Buffers keep the capacity of the largest frame so that steady frames do not allocate, and are
+// shrunk once a plot used less than fraction of them for frame_count consecutive frames (0: never trim)
+IMPLOT3D_API void SetDrawListTrimPolicy(int frame_count = 120, float fraction = 0.25f);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Begin/End Plot
 //-----------------------------------------------------------------------------
@@ -442,21 +524,88 @@ IMPLOT3D_TMP void PlotScatter(const char* label_id, const T* xs, const T* ys, co
 IMPLOT3D_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DLineFlags flags = 0, int offset = 0,
                            int stride = sizeof(T));
 
+// Plot points colored by a fourth variable (e.g. intensity or time): each value is mapped to the current colormap over [scale_min, scale_max].
+// Leave #scale_min and #scale_max both at 0 to use the range of the values. Markers take the color of their point and line segments blend the
+// colors of their two points
+IMPLOT3D_TMP void PlotScatter(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count, double scale_min = 0.0,
+                              double scale_max = 0.0, ImPlot3DScatterFlags flags = 0, int offset = 0, int stride = sizeof(T));
+IMPLOT3D_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count, double scale_min = 0.0,
+                           double scale_max = 0.0, ImPlot3DLineFlags flags = 0, int offset = 0, int stride = sizeof(T));
+
+// Plot the points of a stream (see ImPlot3DStream) as a scatter plot or a line. The stream version identifies the points, so the output is
+// reused while the stream is unchanged. A version set with SetNextItemDataVersion() is kept as well
+IMPLOT3D_API void PlotScatter(const char* label_id, const ImPlot3DStream& stream, ImPlot3DScatterFlags flags = 0);
+IMPLOT3D_API void PlotLine(const char* label_id, const ImPlot3DStream& stream, ImPlot3DLineFlags flags = 0);
+
+// Plot the points pushed to a buffer by a producer thread (see ImPlot3DSPSCBuffer). The pending points are moved to the buffer history first
+IMPLOT3D_API void PlotScatter(const char* label_id, ImPlot3DSPSCBuffer& buffer, ImPlot3DScatterFlags flags = 0);
+IMPLOT3D_API void PlotLine(const char* label_id, ImPlot3DSPSCBuffer& buffer, ImPlot3DLineFlags flags = 0);
+
 IMPLOT3D_TMP void PlotTriangle(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DTriangleFlags flags = 0,
                                int offset = 0, int stride = sizeof(T));
 
 IMPLOT3D_TMP void PlotQuad(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DQuadFlags flags = 0, int offset = 0,
                            int stride = sizeof(T));
 
+// Plot triangles or quads filled with a color per vertex, mapped from #values to the current colormap over [scale_min, scale_max] and
+// interpolated across each primitive. Leave #scale_min and #scale_max both at 0 to use the range of the values
+IMPLOT3D_TMP void PlotTriangle(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count, double scale_min = 0.0,
+                               double scale_max = 0.0, ImPlot3DTriangleFlags flags = 0, int offset = 0, int stride = sizeof(T));
+IMPLOT3D_TMP void PlotQuad(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count, double scale_min = 0.0,
+                           double scale_max = 0.0, ImPlot3DQuadFlags flags = 0, int offset = 0, int stride = sizeof(T));
+
 // Plot the surface defined by a grid of vertices. The grid is defined by the x and y arrays, and the z array contains the height of each vertex. A
 // total of x_count * y_count vertices are expected for each array. Leave #scale_min and #scale_max both at 0 for automatic color scaling, or set them
 // to a predefined range
 IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* xs, const T* ys, const T* zs, int x_count, int y_count, double scale_min = 0.0,
                               double scale_max = 0.0, ImPlot3DSurfaceFlags flags = 0, int offset = 0, int stride = sizeof(T));
 
+// Plot a surface colormapped by a scalar field (e.g. temperature) instead of its height. #values has a value per vertex, like #zs
+IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int x_count, int y_count,
+                              double scale_min = 0.0, double scale_max = 0.0, ImPlot3DSurfaceFlags flags = 0, int offset = 0,
+                              int stride = sizeof(T));
+
+// Plot the surface of a regular grid of x_count * y_count vertices spanning [x_min, x_max] x [y_min, y_max]. Only the heights are read from #zs
+// (zs[y * x_count + x]), the x and y coordinates are computed from the grid and the x and y fit comes from the ranges
+IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* zs, int x_count, int y_count, double x_min, double x_max, double y_min, double y_max,
+                              double scale_min = 0.0, double scale_max = 0.0, ImPlot3DSurfaceFlags flags = 0, int offset = 0, int stride = sizeof(T));
+
 IMPLOT3D_API void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count,
                            ImPlot3DMeshFlags flags = 0);
 
+// Plot a mesh filled with a color per vertex, interpolated across each triangle. The colors are either given (#colors, vtx_count colors whose
+// alpha is scaled by the fill alpha) or mapped from #values to the current colormap over [scale_min, scale_max] (both 0 for the range of the
+// values). Colors are computed once per vertex, not per triangle corner
+IMPLOT3D_API void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count,
+                           const ImU32* colors, ImPlot3DMeshFlags flags = 0);
+IMPLOT3D_API void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count,
+                           const float* values, double scale_min = 0.0, double scale_max = 0.0, ImPlot3DMeshFlags flags = 0);
+
+// Registers a mesh whose triangles do not change in the current context. The mesh is copied, and its unique edges, bounds and triangle
+// adjacency are computed once, so plotting it only projects its vertices and sorts its triangles. Keep the handle for the following frames
+IMPLOT3D_API ImPlot3DMeshHandle CreateMesh(const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count,
+                                           ImPlot3DCreateMeshFlags flags = 0);
+// Replaces the vertex positions of a mesh (e.g. to animate it). vtx_count must be the vtx_count given to CreateMesh()
+IMPLOT3D_API void UpdateMeshVertices(ImPlot3DMeshHandle mesh, const ImPlot3DPoint* vtx, int vtx_count);
+// Releases a mesh. Its handle becomes invalid
+IMPLOT3D_API void DestroyMesh(ImPlot3DMeshHandle mesh);
+// Plots a mesh registered with CreateMesh(). Meshes keep track of their own version, so SetNextItemDataVersion() is not needed to reuse the
+// output of unchanged meshes
+IMPLOT3D_API void PlotMesh(const char* label_id, ImPlot3DMeshHandle mesh, ImPlot3DMeshFlags flags = 0);
+
+// Plots the surface where a scalar volume crosses #iso, extracted with marching cubes. The volume has nx * ny * nz samples stored x first
+// (volume[(z * ny + y) * nx + x]) spanning #bounds. The triangles are extracted in parallel slabs and cached until the volume pointer, data
+// version (see SetNextItemDataVersion()), iso value or bounds change
+IMPLOT3D_TMP void PlotIsosurface(const char* label_id, const T* volume, int nx, int ny, int nz, double iso, const ImPlot3DBox& bounds,
+                                 ImPlot3DIsosurfaceFlags flags = 0);
+
+// Plots the occupied cells of an occupancy grid as voxels. The grid has nx * ny * nz cells stored x first (occupancy[(z * ny + y) * nx + x],
+// nonzero if occupied) dividing #bounds. Only the faces between occupied and empty cells are rendered, with coplanar faces merged into
+// rectangles, and the faces pointing away from the camera are skipped. The faces are extracted in parallel and cached until the grid
+// pointer, data version (see SetNextItemDataVersion()) or bounds change
+IMPLOT3D_API void PlotVoxels(const char* label_id, const ImU8* occupancy, int nx, int ny, int nz, const ImPlot3DBox& bounds,
+                             ImPlot3DVoxelsFlags flags = 0);
+
 // Plots a rectangular image in 3D defined by its center and two direction vectors (axes).
 // #center is the center of the rectangle in plot coordinates.
 // #axis_u and #axis_v define the local axes and half-extents of the rectangle in 3D space.
@@ -480,6 +629,15 @@ IMPLOT3D_API void PlotImage(const char* label_id, ImTextureRef tex_ref, const Im
 // Plots a centered text label at point x,y,z. It is possible to set the text angle in radians and offset in pixels
 IMPLOT3D_API void PlotText(const char* text, float x, float y, float z, float angle = 0.0f, const ImVec2& pix_offset = ImVec2(0, 0));
 
+// Plots the items recorded in a command list (see ImPlot3DCommandList). The list version identifies the recorded points
+IMPLOT3D_API void SubmitCommandList(const ImPlot3DCommandList& list);
+
+// Registers the item #label_id in the current plot and returns its handle. Call between BeginPlot() and EndPlot(), e.g. once when the plot is
+// created, and keep the handle for the following frames. Handles are invalidated by BustItemCache()
+IMPLOT3D_API ImPlot3DItemHandle GetItemHandle(const char* label_id);
+// Submits the next item through its handle: its label_id argument is ignored (may be nullptr), the label given to GetItemHandle() is used
+IMPLOT3D_API void SetNextItemHandle(const ImPlot3DItemHandle& handle);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Utils
 //-----------------------------------------------------------------------------
@@ -497,6 +655,13 @@ IMPLOT3D_API ImPlot3DPoint PixelsToPlotPlane(double x, double y, ImPlane3D plane
 IMPLOT3D_API ImVec2 GetPlotPos();  // Get the current plot position (top-left) in pixels
 IMPLOT3D_API ImVec2 GetPlotSize(); // Get the current plot size in pixels
 
+// Returns true if the plot changed in its last frame or will change in the next frame without user input (e.g. fit, rotation
+// animation, axis dragging, items without data version, hover highlights, mouse text, legend scrolling, open context menus). Call after
+// EndPlot() with the same #title_id passed to BeginPlot()
+IMPLOT3D_API bool IsPlotDirty(const char* title_id);
+// Returns true if any plot submitted in the current or previous frame is dirty. Applications can lower their frame rate while idle
+IMPLOT3D_API bool IsAnyPlotDirty();
+
 //-----------------------------------------------------------------------------
 // [SECTION] Miscellaneous
 //-----------------------------------------------------------------------------
@@ -539,6 +704,19 @@ IMPLOT3D_API void SetNextFillStyle(const ImVec4& col = IMPLOT3D_AUTO_COL, float
 // Set the marker style for the next item only
 IMPLOT3D_API void SetNextMarkerStyle(ImPlot3DMarker marker = IMPLOT3D_AUTO, float size = IMPLOT3D_AUTO, const ImVec4& fill = IMPLOT3D_AUTO_COL,
                                      float weight = IMPLOT3D_AUTO, const ImVec4& outline = IMPLOT3D_AUTO_COL);
+// Set the version of the data of the next item only. When the version, style and view of every item in a plot are the same as in the
+// last frame, the plot reuses its last output instead of rendering the items again. Increase the version whenever the data or any
+// other argument passed to the item changes. Version 0 (default) means unversioned, and the item is always rendered. The vertex normals of
+// shaded meshes and surfaces (ImPlot3DMeshFlags_Shaded, ImPlot3DSurfaceFlags_Shaded) are also kept until the version changes
+IMPLOT3D_API void SetNextItemDataVersion(ImU64 version);
+// Set how the data of the next item is decoded along an axis, e.g. for quantized ImU16/ImS16 samples: values are plotted as
+// value * scale + offset. Fitting and culling use the decoded values. Applies to the items plotted from typed arrays
+IMPLOT3D_API void SetNextItemDataScale(ImAxis3D axis, double scale, double offset = 0.0);
+// Set the maximum number of triangles rendered for the next mesh plotted with ImPlot3DMeshFlags_LOD. The simplified levels of a mesh are
+// built the first time it is plotted and cached until it is no longer plotted. They are identified by the vtx/idx pointers, the counts and
+// the data version, so set a new data version (see SetNextItemDataVersion()) when the mesh changes in place. Meshes created with CreateMesh()
+// keep their levels until they are destroyed
+IMPLOT3D_API void SetNextMeshTriangleBudget(int max_triangles);
 
 // Get color
 IMPLOT3D_API ImVec4 GetStyleColorVec4(ImPlot3DCol idx);
@@ -592,6 +770,13 @@ IMPLOT3D_API int GetColormapSize(ImPlot3DColormap cmap = IMPLOT3D_AUTO);
 IMPLOT3D_API ImVec4 GetColormapColor(int idx, ImPlot3DColormap cmap = IMPLOT3D_AUTO);
 // Sample a color from the current colormap given t between 0 and 1
 IMPLOT3D_API ImVec4 SampleColormap(float t, ImPlot3DColormap cmap = IMPLOT3D_AUTO);
+IMPLOT3D_API ImU32 SampleColormapU32(float t, ImPlot3DColormap cmap = IMPLOT3D_AUTO);
+// Sample count colors from a colormap given an array of t between 0 and 1 (clamped, NaN gives the first color). The colors are read from the
+// colormap table by index, which is much faster than calling SampleColormap() for each value
+IMPLOT3D_API void SampleColormapU32(const float* t, ImU32* out, int count, ImPlot3DColormap cmap = IMPLOT3D_AUTO);
+// Sample count colors from a colormap given an array of values mapped over [scale_min, scale_max] (clamped, NaN gives the first color)
+IMPLOT3D_TMP void SampleColormapU32(const T* values, ImU32* out, int count, double scale_min, double scale_max,
+                                    ImPlot3DColormap cmap = IMPLOT3D_AUTO);
 
 //-----------------------------------------------------------------------------
 // [SECTION] Demo
@@ -798,6 +983,256 @@ struct ImPlot3DQuat {
 #endif
 };
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DVector
+//-----------------------------------------------------------------------------
+
+// Subset of ImVector allocating with malloc()/free() instead of ImGui::MemAlloc(). ImGui::MemAlloc() updates the debug allocation info of
+// the current ImGui context, so buffers filled on other threads (e.g. command lists, mesh loaders) use this vector to not race with the UI
+// thread. Like ImVector, only for types that can be copied with memcpy()
+template <typename T> struct ImPlot3DVector {
+    int Size;
+    int Capacity;
+    T* Data;
+
+    ImPlot3DVector() {
+        Size = Capacity = 0;
+        Data = nullptr;
+    }
+    ImPlot3DVector(const ImPlot3DVector<T>& src) {
+        Size = Capacity = 0;
+        Data = nullptr;
+        operator=(src);
+    }
+    ImPlot3DVector<T>& operator=(const ImPlot3DVector<T>& src) {
+        resize(src.Size);
+        if (src.Size > 0)
+            memcpy(Data, src.Data, (size_t)src.Size * sizeof(T));
+        return *this;
+    }
+    ~ImPlot3DVector() { free(Data); }
+
+    bool empty() const { return Size == 0; }
+    int size() const { return Size; }
+    int size_in_bytes() const { return Size * (int)sizeof(T); }
+    T& operator[](int i) {
+        IM_ASSERT(i >= 0 && i < Size);
+        return Data[i];
+    }
+    const T& operator[](int i) const {
+        IM_ASSERT(i >= 0 && i < Size);
+        return Data[i];
+    }
+    T* begin() { return Data; }
+    const T* begin() const { return Data; }
+    T* end() { return Data + Size; }
+    const T* end() const { return Data + Size; }
+    T& back() {
+        IM_ASSERT(Size > 0);
+        return Data[Size - 1];
+    }
+    const T& back() const {
+        IM_ASSERT(Size > 0);
+        return Data[Size - 1];
+    }
+
+    // Free the memory
+    void clear() {
+        free(Data);
+        Size = Capacity = 0;
+        Data = nullptr;
+    }
+    // Resize without freeing the memory
+    void shrink(int new_size) {
+        IM_ASSERT(new_size <= Size);
+        Size = new_size;
+    }
+    void reserve(int new_capacity) {
+        if (new_capacity <= Capacity)
+            return;
+        T* new_data = (T*)realloc(Data, (size_t)new_capacity * sizeof(T));
+        IM_ASSERT(new_data != nullptr && "Out of memory");
+        Data = new_data;
+        Capacity = new_capacity;
+    }
+    void resize(int new_size) {
+        if (new_size > Capacity)
+            reserve(_GrowCapacity(new_size));
+        Size = new_size;
+    }
+    void push_back(const T& v) {
+        if (Size == Capacity)
+            reserve(_GrowCapacity(Size + 1));
+        Data[Size++] = v;
+    }
+    // Append count elements, resizing once
+    void append(const T* values, int count) {
+        resize(Size + count);
+        memcpy(Data + Size - count, values, (size_t)count * sizeof(T));
+    }
+
+    // [Internal] Same growth as ImVector
+    int _GrowCapacity(int size) const {
+        int new_capacity = Capacity ? (Capacity + Capacity / 2) : 8;
+        return new_capacity > size ? new_capacity : size;
+    }
+};
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DStream
+//-----------------------------------------------------------------------------
+
+// Point buffer for streaming line and scatter items. Points are stored in plot coordinates and the bounds are updated as points are
+// appended, so plotting a stream only needs to project its points (no data conversion or fit pass over the whole history). If #MaxSize
+// is greater than 0, the oldest points are evicted once the stream is full
+struct ImPlot3DStream {
+    ImVector<ImPlot3DPoint> Data; // Points in plot coordinates (ring buffer once full)
+    int MaxSize;                  // Maximum number of points kept, 0 for unlimited
+    int Offset;                   // Index of the oldest point in Data
+    ImU64 Version;                // New version every time the stream changes, unique across streams. Identifies the points when plotted
+
+    IMPLOT3D_API ImPlot3DStream(int max_size = 0);
+
+    // Append points to the stream, evicting the oldest points if the stream is full
+    IMPLOT3D_API void Append(const ImPlot3DPoint& point);
+    IMPLOT3D_API void Append(const ImPlot3DPoint* points, int count);
+    IMPLOT3D_API void Append(const float* xs, const float* ys, const float* zs, int count);
+
+    // Remove all points
+    IMPLOT3D_API void Clear();
+
+    // Change the maximum number of points kept, evicting the oldest points if needed
+    IMPLOT3D_API void SetMaxSize(int max_size);
+
+    // Get the bounds of the non-NaN/Inf point coordinates
+    IMPLOT3D_API ImPlot3DBox GetBounds() const;
+
+    int Size() const { return Data.Size; }
+    const ImPlot3DPoint& operator[](int idx) const { return Data[Offset + idx < Data.Size ? Offset + idx : Offset + idx - Data.Size]; }
+
+    // [Internal] The points are split in chunks with cached bounds, so evicting points only recomputes the bounds of the chunks they belong to
+    mutable ImVector<ImPlot3DBox> _ChunkBounds;
+    mutable ImVector<bool> _ChunkDirty;
+    mutable ImPlot3DBox _Bounds;
+    mutable bool _BoundsDirty;
+    void _Append(const ImPlot3DPoint& point); // Appends a point without changing the version
+};
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DSPSCBuffer
+//-----------------------------------------------------------------------------
+
+struct ImPlot3DSPSCCounters; // Defined in implot3d.cpp
+
+// Lock-free single-producer/single-consumer buffer to plot points produced by another thread. The producer thread pushes points to a ring
+// without ever blocking (points that don't fit are dropped until the consumer catches up). The consumer (UI) thread moves the pending points
+// into History once per frame, so only the new points are copied and the plotted data never changes while it is rendered
+struct ImPlot3DSPSCBuffer {
+    ImPlot3DStream History; // Points received by the consumer thread. Only access it from the consumer thread
+
+    // The capacity is rounded up to a power of two and must be in [1, 2^24]
+    IMPLOT3D_API ImPlot3DSPSCBuffer(int capacity, int max_size = 0);
+    IMPLOT3D_API ~ImPlot3DSPSCBuffer();
+    ImPlot3DSPSCBuffer(const ImPlot3DSPSCBuffer&) = delete;
+    ImPlot3DSPSCBuffer& operator=(const ImPlot3DSPSCBuffer&) = delete;
+
+    // [Producer thread] Push points to the ring. Returns the number of points pushed, less than count if the ring is full
+    IMPLOT3D_API int Push(const ImPlot3DPoint& point);
+    IMPLOT3D_API int Push(const ImPlot3DPoint* points, int count);
+
+    // [Consumer thread] Move the pending points into History. Returns the number of points moved
+    IMPLOT3D_API int Consume();
+
+    // Number of points pushed but not consumed yet, and number of points dropped because the ring was full
+    IMPLOT3D_API int Pending() const;
+    IMPLOT3D_API int Dropped() const;
+
+    // [Internal] The ring capacity is a power of two, so the free-running counters can wrap around
+    ImVector<ImPlot3DPoint> _Ring;
+    unsigned int _Mask;
+    ImPlot3DSPSCCounters* _Counters; // Atomic head, tail and dropped counters
+};
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DCommandList
+//-----------------------------------------------------------------------------
+
+// Records plot items so they can be built on a worker thread and plotted later with SubmitCommandList() between BeginPlot() and EndPlot().
+// Recording doesn't use any context: the data is converted to plot coordinates, meshes are expanded into triangles and the item bounds are
+// computed while recording, so submitting only fits the bounds, projects, sorts and renders the items. Don't modify a list while it is submitted
+struct ImPlot3DCommandList {
+    enum CommandType {
+        CommandType_Scatter,
+        CommandType_Line,
+        CommandType_Triangle,
+        CommandType_Quad,
+        CommandType_Surface,
+        CommandType_Mesh,
+    };
+
+    // Recorded item
+    struct Command {
+        CommandType Type;
+        int Flags;
+        int LabelOffset;       // Offset of the label in Labels
+        int PointOffset;       // Offset of the first point in Points
+        int PointCount;        // Number of points (vertices for meshes)
+        int TriangleCount;     // Number of mesh triangles, whose points follow the mesh vertices
+        int XCount, YCount;    // Surface grid size
+        double ScaleMin;       // Surface color scale
+        double ScaleMax;       // Surface color scale
+        ImPlot3DBox Bounds;    // Bounds of the non-NaN/Inf point coordinates
+        ImVec4 LineColor;      // Arguments of SetNextLineStyle()
+        float LineWeight;      // Arguments of SetNextLineStyle()
+        ImVec4 FillColor;      // Arguments of SetNextFillStyle()
+        float FillAlpha;       // Arguments of SetNextFillStyle()
+        ImPlot3DMarker Marker; // Arguments of SetNextMarkerStyle()
+        float MarkerSize;      // Arguments of SetNextMarkerStyle()
+        ImVec4 MarkerFill;     // Arguments of SetNextMarkerStyle()
+        float MarkerWeight;    // Arguments of SetNextMarkerStyle()
+        ImVec4 MarkerOutline;  // Arguments of SetNextMarkerStyle()
+    };
+
+    // The buffers don't allocate through ImGui, so lists can be recorded on any thread (see ImPlot3DVector)
+    ImPlot3DVector<Command> Commands;     // Recorded items
+    ImPlot3DVector<ImPlot3DPoint> Points; // Points of the recorded items in plot coordinates
+    ImPlot3DVector<char> Labels;          // Null-terminated labels of the recorded items
+    ImU64 Version;                  // New version every time the list changes, unique across lists. Identifies the points when submitted
+
+    IMPLOT3D_API ImPlot3DCommandList();
+
+    // Remove all recorded items (keeps the memory)
+    IMPLOT3D_API void Clear();
+
+    // Set the style of the next recorded item only, see SetNextLineStyle(), SetNextFillStyle() and SetNextMarkerStyle()
+    IMPLOT3D_API void SetNextLineStyle(const ImVec4& col = IMPLOT3D_AUTO_COL, float weight = IMPLOT3D_AUTO);
+    IMPLOT3D_API void SetNextFillStyle(const ImVec4& col = IMPLOT3D_AUTO_COL, float alpha_mod = IMPLOT3D_AUTO);
+    IMPLOT3D_API void SetNextMarkerStyle(ImPlot3DMarker marker = IMPLOT3D_AUTO, float size = IMPLOT3D_AUTO, const ImVec4& fill = IMPLOT3D_AUTO_COL,
+                                         float weight = IMPLOT3D_AUTO, const ImVec4& outline = IMPLOT3D_AUTO_COL);
+
+    // Record items, same arguments as the ImPlot3D::Plot* functions
+    IMPLOT3D_TMP void PlotScatter(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DScatterFlags flags = 0,
+                                  int offset = 0, int stride = sizeof(T));
+    IMPLOT3D_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DLineFlags flags = 0, int offset = 0,
+                               int stride = sizeof(T));
+    IMPLOT3D_TMP void PlotTriangle(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DTriangleFlags flags = 0,
+                                   int offset = 0, int stride = sizeof(T));
+    IMPLOT3D_TMP void PlotQuad(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DQuadFlags flags = 0, int offset = 0,
+                               int stride = sizeof(T));
+    IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* xs, const T* ys, const T* zs, int x_count, int y_count, double scale_min = 0.0,
+                                  double scale_max = 0.0, ImPlot3DSurfaceFlags flags = 0, int offset = 0, int stride = sizeof(T));
+    IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* zs, int x_count, int y_count, double x_min, double x_max, double y_min,
+                                  double y_max, double scale_min = 0.0, double scale_max = 0.0, ImPlot3DSurfaceFlags flags = 0, int offset = 0,
+                                  int stride = sizeof(T));
+    IMPLOT3D_API void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count,
+                               ImPlot3DMeshFlags flags = 0);
+
+    // [Internal]
+    Command _NextStyle; // Style of the next recorded item
+    IMPLOT3D_API Command& _AddCommand(CommandType type, const char* label_id, int flags);
+    IMPLOT3D_API void _ResetNextStyle();
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImPlot3DStyle
 //-----------------------------------------------------------------------------
@@ -29,6 +29,13 @@
 #include "implot3d.h"
 #include "implot3d_internal.h"
 
+#ifndef IMPLOT3D_DISABLE_THREADS
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] User Namespace
 //-----------------------------------------------------------------------------
@@ -136,6 +143,48 @@ void DemoScatterPlots() {
     }
 }
 
+void DemoColoredPoints() {
+    ImGui::BulletText("Points can be colored by a fourth variable mapped to the current colormap.");
+    ImGui::BulletText("Line segments blend the colors of their two points.");
+    static bool fade = true;
+    ImGui::Checkbox("Fade trail", &fade);
+
+    // Points of a spiral colored by their distance to the axis
+    static float xs1[500], ys1[500], zs1[500], vs1[500];
+    for (int i = 0; i < 500; i++) {
+        float t = i * 0.05f;
+        float r = 0.5f + 0.4f * sinf(t * 0.3f);
+        xs1[i] = r * cosf(t);
+        ys1[i] = r * sinf(t);
+        zs1[i] = i / 500.0f;
+        vs1[i] = r;
+    }
+    // Trail of a moving point colored by its speed
+    static float xs2[300], ys2[300], zs2[300], vs2[300];
+    float time = (float)ImGui::GetTime();
+    for (int i = 0; i < 300; i++) {
+        float t = time - (299 - i) * 0.01f;
+        xs2[i] = 0.8f * sinf(1.3f * t);
+        ys2[i] = 0.8f * cosf(0.7f * t) * sinf(1.1f * t);
+        zs2[i] = 0.5f + 0.4f * sinf(2.1f * t);
+        float dx = 1.04f * cosf(1.3f * t);
+        float dz = 0.84f * cosf(2.1f * t);
+        vs2[i] = sqrtf(dx * dx + dz * dz);
+    }
+
+    if (ImPlot3D::BeginPlot("Colored Points")) {
+        ImPlot3D::PushColormap("Viridis");
+        ImPlot3D::SetNextMarkerStyle(ImPlot3DMarker_Circle, 3);
+        ImPlot3D::PlotScatter("Spiral", xs1, ys1, zs1, vs1, 500);
+        ImPlot3D::PopColormap();
+        ImPlot3D::PushColormap("Hot");
+        ImPlot3D::SetNextLineStyle(IMPLOT3D_AUTO_COL, 3.0f);
+        ImPlot3D::PlotLine("Trail", xs2, ys2, zs2, vs2, 300, 0.0, 2.0, fade ? ImPlot3DLineFlags_Fade : ImPlot3DLineFlags_None);
+        ImPlot3D::PopColormap();
+        ImPlot3D::EndPlot();
+    }
+}
+
 void DemoTrianglePlots() {
     // Pyramid coordinates
     // Apex
@@ -365,6 +414,7 @@ void DemoSurfacePlots() {
     CHECKBOX_FLAG(flags, ImPlot3DSurfaceFlags_NoLines);
     CHECKBOX_FLAG(flags, ImPlot3DSurfaceFlags_NoFill);
     CHECKBOX_FLAG(flags, ImPlot3DSurfaceFlags_NoMarkers);
+    CHECKBOX_FLAG(flags, ImPlot3DSurfaceFlags_Shaded);
 
     // Begin the plot
     if (selected_fill == 1)
@@ -397,6 +447,35 @@ void DemoSurfacePlots() {
         ImPlot3D::PopColormap();
 }
 
+void DemoHeightFields() {
+    ImGui::BulletText("Regular grids only need their heights: x and y are computed from the x and y ranges.");
+    ImGui::BulletText("The heights are a 256x256 ImU16 elevation raster, decoded to meters with SetNextItemDataScale().");
+
+    constexpr int N = 256;
+    static ImU16 elevation[N * N];
+    static bool init = true;
+    if (init) {
+        for (int j = 0; j < N; j++) {
+            for (int i = 0; i < N; i++) {
+                float x = (float)i / (N - 1), y = (float)j / (N - 1);
+                float h = 0.5f + 0.3f * ImSin(7.0f * x) * ImCos(5.0f * y) + 0.15f * ImSin(23.0f * x + 17.0f * y);
+                elevation[j * N + i] = (ImU16)(ImClamp(h, 0.0f, 1.0f) * 65535.0f);
+            }
+        }
+        init = false;
+    }
+
+    ImPlot3D::PushColormap("Viridis");
+    if (ImPlot3D::BeginPlot("Height Fields", ImVec2(-1, 400))) {
+        ImPlot3D::SetupAxes("East [km]", "North [km]", "Elevation [m]");
+        ImPlot3D::SetNextItemDataScale(ImAxis3D_Z, 1500.0 / 65535.0, 200.0);
+        ImPlot3D::PlotSurface("Terrain", elevation, N, N, 0.0, 12.8, 0.0, 12.8, 0.0, 0.0,
+                              ImPlot3DSurfaceFlags_NoLines | ImPlot3DSurfaceFlags_NoMarkers);
+        ImPlot3D::EndPlot();
+    }
+    ImPlot3D::PopColormap();
+}
+
 void DemoMeshPlots() {
     static int mesh_id = 0;
     ImGui::Combo("Mesh", &mesh_id, "Duck\0Sphere\0Cube\0\0");
@@ -418,6 +497,7 @@ void DemoMeshPlots() {
     CHECKBOX_FLAG(flags, ImPlot3DMeshFlags_NoLines);
     CHECKBOX_FLAG(flags, ImPlot3DMeshFlags_NoFill);
     CHECKBOX_FLAG(flags, ImPlot3DMeshFlags_NoMarkers);
+    CHECKBOX_FLAG(flags, ImPlot3DMeshFlags_Shaded);
 
     if (ImPlot3D::BeginPlot("Mesh Plots")) {
         ImPlot3D::SetupAxesLimits(-1, 1, -1, 1, -1, 1);
@@ -443,6 +523,194 @@ void DemoMeshPlots() {
     }
 }
 
+void DemoColoredMeshes() {
+    ImGui::BulletText("Meshes and surfaces can take a color per vertex, interpolated across each triangle.");
+    ImGui::BulletText("The colors are given, or mapped to the current colormap from a scalar field.");
+    static int mode = 0;
+    ImGui::Combo("Coloring", &mode, "Scalar field\0Vertex colors\0\0");
+
+    // Scalar field traveling around the sphere (e.g. a temperature)
+    float time = (float)ImGui::GetTime();
+    static float values[SPHERE_VTX_COUNT];
+    static ImU32 colors[SPHERE_VTX_COUNT];
+    for (int i = 0; i < SPHERE_VTX_COUNT; i++) {
+        const ImPlot3DPoint& p = sphere_vtx[i];
+        values[i] = sinf(3.0f * p.x + time) * cosf(2.0f * p.z - time);
+        colors[i] = ImGui::GetColorU32(ImVec4(0.5f + 0.5f * p.x, 0.5f + 0.5f * p.y, 0.5f + 0.5f * p.z, 1.0f));
+    }
+
+    // Surface colored by its slope instead of its height
+    constexpr int N = 40;
+    static float xs[N * N], ys[N * N], zs[N * N], slopes[N * N];
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            int idx = i * N + j;
+            xs[idx] = 2.5f + j * 3.0f / (N - 1);
+            ys[idx] = -1.5f + i * 3.0f / (N - 1);
+            zs[idx] = 0.5f * sinf(2.0f * xs[idx]) * cosf(2.0f * ys[idx]);
+            float dx = cosf(2.0f * xs[idx]) * cosf(2.0f * ys[idx]);
+            float dy = sinf(2.0f * xs[idx]) * sinf(2.0f * ys[idx]);
+            slopes[idx] = sqrtf(dx * dx + dy * dy);
+        }
+    }
+
+    if (ImPlot3D::BeginPlot("Colored Meshes")) {
+        ImPlot3D::SetupAxesLimits(-1.5, 5.5, -1.5, 1.5, -1.5, 1.5);
+        ImPlot3D::PushColormap("Plasma");
+        if (mode == 0)
+            ImPlot3D::PlotMesh("Sphere", sphere_vtx, sphere_idx, SPHERE_VTX_COUNT, SPHERE_IDX_COUNT, values, -1.0, 1.0,
+                               ImPlot3DMeshFlags_NoLines | ImPlot3DMeshFlags_NoMarkers);
+        else
+            ImPlot3D::PlotMesh("Sphere", sphere_vtx, sphere_idx, SPHERE_VTX_COUNT, SPHERE_IDX_COUNT, colors,
+                               ImPlot3DMeshFlags_NoLines | ImPlot3DMeshFlags_NoMarkers);
+        ImPlot3D::PlotSurface("Slope", xs, ys, zs, slopes, N, N, 0.0, 0.0, ImPlot3DSurfaceFlags_NoLines | ImPlot3DSurfaceFlags_NoMarkers);
+        ImPlot3D::PopColormap();
+        ImPlot3D::EndPlot();
+    }
+}
+
+void DemoMeshLOD() {
+    ImGui::BulletText("The torus below has 204800 triangles, built once into a chain of simplified levels.");
+    ImGui::BulletText("With ImPlot3DMeshFlags_LOD, the level drawn matches the size of the mesh on screen (zoom in and out).");
+
+    constexpr int RINGS = 320;
+    constexpr int SIDES = 320;
+    static ImPlot3DPoint vtx[RINGS * SIDES];
+    static unsigned int idx[RINGS * SIDES * 6];
+    static bool init = true;
+    if (init) {
+        for (int i = 0; i < RINGS; i++) {
+            float u = 2.0f * IM_PI * i / RINGS;
+            for (int j = 0; j < SIDES; j++) {
+                float v = 2.0f * IM_PI * j / SIDES;
+                // Bumpy tube around a circle of radius 0.7
+                float r = 0.25f + 0.03f * ImSin(7.0f * u) * ImSin(5.0f * v);
+                vtx[i * SIDES + j] = ImPlot3DPoint((0.7f + r * ImCos(v)) * ImCos(u), (0.7f + r * ImCos(v)) * ImSin(u), r * ImSin(v));
+                unsigned int a = i * SIDES + j, b = i * SIDES + (j + 1) % SIDES;
+                unsigned int c = ((i + 1) % RINGS) * SIDES + j, d = ((i + 1) % RINGS) * SIDES + (j + 1) % SIDES;
+                unsigned int* t = &idx[(i * SIDES + j) * 6];
+                t[0] = a, t[1] = b, t[2] = d, t[3] = a, t[4] = d, t[5] = c;
+            }
+        }
+        init = false;
+    }
+    static bool lod = true;
+    ImGui::Checkbox("Level of Detail", &lod);
+    static int budget = 0;
+    ImGui::SliderInt("Triangle Budget", &budget, 0, 100000, budget == 0 ? "No Budget" : "%d");
+
+    if (ImPlot3D::BeginPlot("Mesh LOD", ImVec2(-1, 400))) {
+        ImPlot3D::SetupAxesLimits(-1, 1, -1, 1, -1, 1);
+        ImPlot3D::SetNextFillStyle(ImVec4(0.8f, 0.8f, 0.2f, 0.6f));
+        ImPlot3D::SetNextLineStyle(ImVec4(0.5f, 0.5f, 0.2f, 0.6f));
+        if (budget > 0)
+            ImPlot3D::SetNextMeshTriangleBudget(budget);
+        ImPlot3D::PlotMesh("Torus", vtx, idx, RINGS * SIDES, RINGS * SIDES * 6, ImPlot3DMeshFlags_NoMarkers | (lod ? ImPlot3DMeshFlags_LOD : 0));
+        ImPlot3D::EndPlot();
+    }
+}
+
+void DemoRegisteredMeshes() {
+    ImGui::BulletText("The sphere is registered once with CreateMesh(), which computes its edges and bounds.");
+    ImGui::BulletText("Each frame only its vertices are updated with UpdateMeshVertices(), then projected and sorted.");
+
+    static ImPlot3DMeshHandle mesh;
+    static ImPlot3DPoint vtx[SPHERE_VTX_COUNT];
+    if (mesh.ID == 0)
+        mesh = ImPlot3D::CreateMesh(sphere_vtx, sphere_idx, SPHERE_VTX_COUNT, SPHERE_IDX_COUNT);
+    static bool animate = true;
+    ImGui::Checkbox("Animate", &animate);
+    if (animate) {
+        // Ripple along the z axis
+        float t = (float)ImGui::GetTime();
+        for (int i = 0; i < SPHERE_VTX_COUNT; i++)
+            vtx[i] = sphere_vtx[i] * (1.0f + 0.15f * ImSin(6.0f * sphere_vtx[i].z - 3.0f * t));
+        ImPlot3D::UpdateMeshVertices(mesh, vtx, SPHERE_VTX_COUNT);
+    }
+
+    if (ImPlot3D::BeginPlot("Registered Meshes", ImVec2(-1, 400))) {
+        ImPlot3D::SetupAxesLimits(-1.2, 1.2, -1.2, 1.2, -1.2, 1.2);
+        ImPlot3D::SetNextFillStyle(ImVec4(0.2f, 0.6f, 0.8f, 0.6f));
+        ImPlot3D::SetNextLineStyle(ImVec4(0.1f, 0.3f, 0.4f, 0.8f));
+        ImPlot3D::PlotMesh("Sphere", mesh, ImPlot3DMeshFlags_NoMarkers);
+        ImPlot3D::EndPlot();
+    }
+}
+
+void DemoIsosurfaces() {
+    ImGui::BulletText("The surface is extracted from a 64x64x64 volume with marching cubes.");
+    ImGui::BulletText("The triangles are cached, dragging the iso value only extracts them again for this item.");
+
+    constexpr int N = 64;
+    static float volume[N * N * N];
+    static bool init = true;
+    if (init) {
+        // Gyroid
+        for (int k = 0; k < N; k++) {
+            for (int j = 0; j < N; j++) {
+                for (int i = 0; i < N; i++) {
+                    float x = 2.0f * IM_PI * i / (N - 1), y = 2.0f * IM_PI * j / (N - 1), z = 2.0f * IM_PI * k / (N - 1);
+                    volume[(k * N + j) * N + i] = ImSin(x) * ImCos(y) + ImSin(y) * ImCos(z) + ImSin(z) * ImCos(x);
+                }
+            }
+        }
+        init = false;
+    }
+    static float iso = 0.0f;
+    ImGui::SliderFloat("Iso Value", &iso, -1.0f, 1.0f);
+    static bool shaded = true;
+    ImGui::Checkbox("Shaded", &shaded);
+
+    if (ImPlot3D::BeginPlot("Isosurfaces", ImVec2(-1, 400))) {
+        ImPlot3D::SetupAxesLimits(-1, 1, -1, 1, -1, 1);
+        ImPlot3D::SetNextFillStyle(ImVec4(0.9f, 0.5f, 0.2f, 0.8f));
+        ImPlot3D::PlotIsosurface("Gyroid", volume, N, N, N, iso, ImPlot3DBox(ImPlot3DPoint(-1, -1, -1), ImPlot3DPoint(1, 1, 1)),
+                                 ImPlot3DIsosurfaceFlags_NoMarkers | (shaded ? ImPlot3DIsosurfaceFlags_Shaded : 0));
+        ImPlot3D::EndPlot();
+    }
+}
+
+void DemoVoxels() {
+    ImGui::BulletText("Terrain of a 128x128x64 occupancy grid, only the faces between occupied and empty cells are rendered.");
+    ImGui::BulletText("Coplanar faces are merged into rectangles and faces pointing away from the camera are skipped.");
+
+    constexpr int NX = 128, NY = 128, NZ = 64;
+    static ImU8 occupancy[NX * NY * NZ];
+    static float height = 0.5f;
+    static ImU64 version = 0;
+    bool changed = ImGui::SliderFloat("Height", &height, 0.0f, 1.0f);
+    if (changed || version == 0) {
+        // Hills with caves carved out of them
+        for (int k = 0; k < NZ; k++) {
+            for (int j = 0; j < NY; j++) {
+                for (int i = 0; i < NX; i++) {
+                    float x = (float)i / NX, y = (float)j / NY, z = (float)k / NZ;
+                    float ground = height * (0.5f + 0.25f * ImSin(6.0f * x) * ImCos(5.0f * y) + 0.15f * ImSin(13.0f * (x + y)));
+                    float cave = ImSin(17.0f * x) * ImSin(19.0f * y) * ImSin(23.0f * z);
+                    occupancy[(k * NY + j) * NX + i] = z < ground && cave < 0.6f;
+                }
+            }
+        }
+        version++;
+    }
+    static bool show_faces = false;
+    ImGui::Checkbox("Show Merged Faces", &show_faces);
+    static bool shaded = true;
+    ImGui::Checkbox("Shaded", &shaded);
+
+    if (ImPlot3D::BeginPlot("Voxels", ImVec2(-1, 400))) {
+        ImPlot3D::SetupAxesLimits(0, 2, 0, 2, 0, 1);
+        ImPlot3D::SetupBoxScale(1.0f, 1.0f, 0.5f);
+        ImPlot3D::SetNextFillStyle(ImVec4(0.45f, 0.65f, 0.35f, 1.0f));
+        if (show_faces)
+            ImPlot3D::SetNextLineStyle(ImVec4(0.1f, 0.2f, 0.1f, 1.0f));
+        ImPlot3D::SetNextItemDataVersion(version);
+        ImPlot3D::PlotVoxels("Terrain", occupancy, NX, NY, NZ, ImPlot3DBox(ImPlot3DPoint(0, 0, 0), ImPlot3DPoint(2, 2, 1)),
+                             shaded ? ImPlot3DVoxelsFlags_Shaded : 0);
+        ImPlot3D::EndPlot();
+    }
+}
+
 void DemoImagePlots() {
     ImGui::BulletText("Below we are displaying the font texture, which is the only texture we have\naccess to in this demo.");
     ImGui::BulletText("Use the 'ImTextureID' type as storage to pass pointers or identifiers to your\nown texture data.");
@@ -544,6 +812,156 @@ void DemoRealtimePlots() {
     }
 }
 
+void DemoStreamingPlots() {
+    ImGui::BulletText("Streams keep their points in plot coordinates and update their bounds as points are appended.");
+    ImGui::BulletText("Only the new points are processed when fitting, and the oldest points are evicted once full.");
+    static ImPlot3DStream stream(100000);
+    static int max_size = 100000;
+    static int points_per_frame = 100;
+    static bool paused = false;
+    static float t = 0.0f;
+    if (ImGui::SliderInt("Max Size", &max_size, 1000, 1000000))
+        stream.SetMaxSize(max_size);
+    ImGui::SliderInt("Points per Frame", &points_per_frame, 1, 1000);
+    ImGui::Checkbox("Paused", &paused);
+    ImGui::SameLine();
+    if (ImGui::Button("Clear"))
+        stream.Clear();
+    ImGui::SameLine();
+    ImGui::Text("Size: %d", stream.Size());
+
+    // Append points along a helix with noise
+    if (!paused) {
+        for (int i = 0; i < points_per_frame; i++) {
+            t += 0.001f;
+            float noise = 0.05f * ((float)rand() / (float)RAND_MAX - 0.5f);
+            stream.Append(ImPlot3DPoint(ImCos(t * 10.0f) + noise, ImSin(t * 10.0f) + noise, t));
+        }
+    }
+
+    const ImPlot3DAxisFlags flags = ImPlot3DAxisFlags_AutoFit;
+    if (ImPlot3D::BeginPlot("Streaming Plot", ImVec2(-1, 400))) {
+        ImPlot3D::SetupAxes("x", "y", "t", flags, flags, flags);
+        ImPlot3D::PlotLine("Helix", stream);
+        ImPlot3D::EndPlot();
+    }
+}
+
+void DemoThreadedData() {
+#ifndef IMPLOT3D_DISABLE_THREADS
+    ImGui::BulletText("A producer thread pushes points of the Lorenz attractor to a lock-free ImPlot3DSPSCBuffer.");
+    ImGui::BulletText("Every frame, only the points pushed since the last frame are moved to the buffer history and plotted.");
+    struct Producer {
+        ImPlot3DSPSCBuffer Buffer;
+        std::atomic<int> PointsPerMs;
+        std::atomic<bool> Quit;
+        std::thread Thread;
+        Producer() : Buffer(65536, 50000), PointsPerMs(20), Quit(false) { Thread = std::thread(&Producer::Run, this); }
+        ~Producer() {
+            Quit.store(true);
+            Thread.join();
+        }
+        void Run() {
+            ImPlot3DPoint p(0.1f, 0.0f, 0.0f);
+            ImPlot3DPoint batch[1000];
+            while (!Quit.load()) {
+                // Integrate the Lorenz system with the classic parameters
+                int count = PointsPerMs.load();
+                for (int i = 0; i < count; i++) {
+                    const float dt = 0.001f;
+                    ImPlot3DPoint d(10.0f * (p.y - p.x), p.x * (28.0f - p.z) - p.y, p.x * p.y - 8.0f / 3.0f * p.z);
+                    p = p + d * dt;
+                    batch[i] = p;
+                }
+                Buffer.Push(batch, count);
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    };
+    // The producer starts the first time the demo is shown and is stopped and joined when the application exits
+    static Producer producer;
+    static int points_per_ms = 20;
+    if (ImGui::SliderInt("Points per ms", &points_per_ms, 1, 1000))
+        producer.PointsPerMs.store(points_per_ms);
+    ImGui::Text("Size: %d, Pending: %d, Dropped: %d", producer.Buffer.History.Size(), producer.Buffer.Pending(), producer.Buffer.Dropped());
+
+    const ImPlot3DAxisFlags flags = ImPlot3DAxisFlags_AutoFit;
+    if (ImPlot3D::BeginPlot("Threaded Data", ImVec2(-1, 400))) {
+        ImPlot3D::SetupAxes("x", "y", "z", flags, flags, flags);
+        ImPlot3D::PlotLine("Lorenz", producer.Buffer);
+        ImPlot3D::EndPlot();
+    }
+#else
+    ImGui::BulletText("This demo requires threads (IMPLOT3D_DISABLE_THREADS is defined).");
+#endif
+}
+
+void DemoCommandLists() {
+#ifndef IMPLOT3D_DISABLE_THREADS
+    ImGui::BulletText("A worker thread evaluates a wave surface and records it to an ImPlot3DCommandList.");
+    ImGui::BulletText("The UI thread only submits the latest finished list inside BeginPlot/EndPlot.");
+    struct Worker {
+        enum { N = 200 };
+        std::mutex Mutex;
+        ImPlot3DCommandList Lists[2];
+        int Front;
+        bool Ready;
+        std::atomic<bool> Quit;
+        std::thread Thread;
+        Worker() : Front(0), Ready(false), Quit(false) { Thread = std::thread(&Worker::Run, this); }
+        ~Worker() {
+            Quit.store(true);
+            Thread.join();
+        }
+        void Run() {
+            static float xs[N * N], ys[N * N], zs[N * N];
+            float t = 0.0f;
+            while (!Quit.load()) {
+                for (int i = 0; i < N; i++) {
+                    for (int j = 0; j < N; j++) {
+                        int idx = i * N + j;
+                        xs[idx] = -2.0f + 4.0f * j / (N - 1);
+                        ys[idx] = -2.0f + 4.0f * i / (N - 1);
+                        float r = ImSqrt(xs[idx] * xs[idx] + ys[idx] * ys[idx]);
+                        zs[idx] = ImSin(4.0f * r - t) / (1.0f + r);
+                    }
+                }
+                // The back list is only touched by this thread
+                ImPlot3DCommandList& back = Lists[1 - Front];
+                back.Clear();
+                back.SetNextFillStyle(IMPLOT3D_AUTO_COL, 0.9f);
+                back.PlotSurface("Wave", xs, ys, zs, N, N, -1.0, 1.0, ImPlot3DSurfaceFlags_NoLines);
+                {
+                    std::lock_guard<std::mutex> lock(Mutex);
+                    Front = 1 - Front;
+                    Ready = true;
+                }
+                t += 0.05f;
+                std::this_thread::sleep_for(std::chrono::milliseconds(16));
+            }
+        }
+    };
+    // The worker starts the first time the demo is shown and is stopped and joined when the application exits
+    static Worker worker;
+
+    const ImPlot3DAxisFlags flags = ImPlot3DAxisFlags_AutoFit;
+    if (ImPlot3D::BeginPlot("Command Lists", ImVec2(-1, 400))) {
+        ImPlot3D::SetupAxes("x", "y", "z", flags, flags, flags);
+        ImPlot3D::PushColormap("Jet");
+        {
+            // Hold the lock while submitting so the worker does not swap the front list
+            std::lock_guard<std::mutex> lock(worker.Mutex);
+            if (worker.Ready)
+                ImPlot3D::SubmitCommandList(worker.Lists[worker.Front]);
+        }
+        ImPlot3D::PopColormap();
+        ImPlot3D::EndPlot();
+    }
+#else
+    ImGui::BulletText("This demo requires threads (IMPLOT3D_DISABLE_THREADS is defined).");
+#endif
+}
+
 void DemoMarkersAndText() {
     static float mk_size = ImPlot3D::GetStyle().MarkerSize;
     static float mk_weight = ImPlot3D::GetStyle().MarkerWeight;
@@ -790,6 +1208,130 @@ void DemoCustomRendering() {
     }
 }
 
+void DemoDataVersions() {
+    ImGui::BulletText("When every item of a plot has a data version and nothing changed since the last frame,\n"
+                      "the plot reuses its last output instead of rendering and sorting the items again.");
+    ImGui::BulletText("Increase the version whenever the data changes.");
+
+    constexpr int N = 1000;
+    static float xs[N], ys[N], zs[N];
+    static ImU64 version = 0;
+    static bool use_versions = true;
+    if (version == 0 || ImGui::Button("Regenerate Data")) {
+        for (int i = 0; i < N; i++) {
+            xs[i] = (float)rand() / (float)RAND_MAX;
+            ys[i] = (float)rand() / (float)RAND_MAX;
+            zs[i] = (float)rand() / (float)RAND_MAX;
+        }
+        version++;
+    }
+    ImGui::SameLine();
+    ImGui::Checkbox("Use Data Versions", &use_versions);
+
+    // Dirty plots changed in the last frame or will change without user input
+    static int dirty_count = 0;
+    ImGui::SameLine();
+    ImGui::Text("Dirty plots: %d/16", dirty_count);
+    dirty_count = 0;
+
+    for (int p = 0; p < 16; p++) {
+        ImGui::PushID(p);
+        if (ImPlot3D::BeginPlot("##DataVersions", ImVec2(150, 150), ImPlot3DFlags_CanvasOnly)) {
+            ImPlot3D::SetupAxesLimits(0, 1, 0, 1, 0, 1);
+            if (use_versions)
+                ImPlot3D::SetNextItemDataVersion(version);
+            ImPlot3D::PlotScatter("Data", xs, ys, zs, N);
+            ImPlot3D::EndPlot();
+            if (ImPlot3D::IsPlotDirty("##DataVersions"))
+                dirty_count++;
+        }
+        ImGui::PopID();
+        if (p % 4 != 3)
+            ImGui::SameLine();
+    }
+}
+
+void DemoQuantizedData() {
+    ImGui::BulletText("The surface is stored as ImS16 grid indices and heights.");
+    ImGui::BulletText("SetNextItemDataScale() decodes them while plotting, without converting the data to floats.");
+
+    constexpr int N = 64;
+    static ImS16 xs[N * N], ys[N * N], zs[N * N];
+    static bool init = true;
+    if (init) {
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                int idx = i * N + j;
+                xs[idx] = (ImS16)j;
+                ys[idx] = (ImS16)i;
+                float x = -1.0f + 2.0f * j / (N - 1);
+                float y = -1.0f + 2.0f * i / (N - 1);
+                zs[idx] = (ImS16)(32767 * ImSin(3.0f * x) * ImCos(3.0f * y));
+            }
+        }
+        init = false;
+    }
+    static float height = 0.5f;
+    ImGui::SliderFloat("Height", &height, 0.1f, 2.0f);
+
+    if (ImPlot3D::BeginPlot("Quantized Data", ImVec2(-1, 400))) {
+        ImPlot3D::SetupAxesLimits(-1, 1, -1, 1, -2, 2);
+        ImPlot3D::PushColormap("Viridis");
+        // Grid indices [0, N-1] map to [-1, 1], heights [-32767, 32767] map to [-height, height]
+        ImPlot3D::SetNextItemDataScale(ImAxis3D_X, 2.0 / (N - 1), -1.0);
+        ImPlot3D::SetNextItemDataScale(ImAxis3D_Y, 2.0 / (N - 1), -1.0);
+        ImPlot3D::SetNextItemDataScale(ImAxis3D_Z, height / 32767.0);
+        ImPlot3D::PlotSurface("Surface", xs, ys, zs, N, N);
+        ImPlot3D::PopColormap();
+        ImPlot3D::EndPlot();
+    }
+}
+
+void DemoItemHandles() {
+    ImGui::BulletText("Items registered once with GetItemHandle() are submitted without hashing or copying their labels.");
+    ImGui::BulletText("The legend only measures and draws the visible entries, scroll it with the mouse wheel.");
+
+    constexpr int ITEMS = 2000;
+    constexpr int POINTS = 16;
+    static float xs[ITEMS][POINTS], ys[ITEMS][POINTS], zs[ITEMS][POINTS];
+    static bool init = true;
+    if (init) {
+        // Random walks starting from the origin
+        for (int i = 0; i < ITEMS; i++) {
+            xs[i][0] = ys[i][0] = zs[i][0] = 0.0f;
+            for (int j = 1; j < POINTS; j++) {
+                xs[i][j] = xs[i][j - 1] + (float)rand() / (float)RAND_MAX - 0.5f;
+                ys[i][j] = ys[i][j - 1] + (float)rand() / (float)RAND_MAX - 0.5f;
+                zs[i][j] = zs[i][j - 1] + (float)rand() / (float)RAND_MAX - 0.5f;
+            }
+        }
+        init = false;
+    }
+    static bool use_handles = true;
+    ImGui::Checkbox("Use Item Handles", &use_handles);
+
+    static ImPlot3DItemHandle handles[ITEMS];
+    if (ImPlot3D::BeginPlot("Item Handles", ImVec2(-1, 400))) {
+        ImPlot3D::SetupAxesLimits(-3, 3, -3, 3, -3, 3);
+        char label[32];
+        for (int i = 0; i < ITEMS; i++) {
+            if (use_handles) {
+                // Handles are created once and kept for the following frames
+                if (handles[i].ID == 0) {
+                    ImFormatString(label, sizeof(label), "Walk %d", i);
+                    handles[i] = ImPlot3D::GetItemHandle(label);
+                }
+                ImPlot3D::SetNextItemHandle(handles[i]);
+                ImPlot3D::PlotLine(nullptr, xs[i], ys[i], zs[i], POINTS);
+            } else {
+                ImFormatString(label, sizeof(label), "Walk %d", i);
+                ImPlot3D::PlotLine(label, xs[i], ys[i], zs[i], POINTS);
+            }
+        }
+        ImPlot3D::EndPlot();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Demo Window
 //-----------------------------------------------------------------------------
@@ -870,14 +1412,25 @@ void ShowAllDemos() {
         if (ImGui::BeginTabItem("Plots")) {
             DemoHeader("Line Plots", DemoLinePlots);
             DemoHeader("Scatter Plots", DemoScatterPlots);
+            DemoHeader("Colored Points", DemoColoredPoints);
             DemoHeader("Triangle Plots", DemoTrianglePlots);
             DemoHeader("Quad Plots", DemoQuadPlots);
             DemoHeader("Surface Plots", DemoSurfacePlots);
+            DemoHeader("Height Fields", DemoHeightFields);
             DemoHeader("Mesh Plots", DemoMeshPlots);
+            DemoHeader("Colored Meshes", DemoColoredMeshes);
+            DemoHeader("Mesh LOD", DemoMeshLOD);
+            DemoHeader("Registered Meshes", DemoRegisteredMeshes);
+            DemoHeader("Isosurfaces", DemoIsosurfaces);
+            DemoHeader("Voxels", DemoVoxels);
             DemoHeader("Realtime Plots", DemoRealtimePlots);
+            DemoHeader("Streaming Plots", DemoStreamingPlots);
+            DemoHeader("Threaded Data", DemoThreadedData);
+            DemoHeader("Command Lists", DemoCommandLists);
             DemoHeader("Image Plots", DemoImagePlots);
             DemoHeader("Markers and Text", DemoMarkersAndText);
             DemoHeader("NaN Values", DemoNaNValues);
+            DemoHeader("Quantized Data", DemoQuantizedData);
             ImGui::EndTabItem();
         }
         if (ImGui::BeginTabItem("Axes")) {
@@ -890,6 +1443,8 @@ void ShowAllDemos() {
         if (ImGui::BeginTabItem("Custom")) {
             DemoHeader("Custom Styles", DemoCustomStyles);
             DemoHeader("Custom Rendering", DemoCustomRendering);
+            DemoHeader("Data Versions", DemoDataVersions);
+            DemoHeader("Item Handles", DemoItemHandles);
             ImGui::EndTabItem();
         }
         if (ImGui::BeginTabItem("Help")) {
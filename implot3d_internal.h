@@ -21,6 +21,7 @@
 // [SECTION] Context Utils
 // [SECTION] Style Utils
 // [SECTION] Item Utils
+// [SECTION] Mesh Utils
 // [SECTION] Plot Utils
 // [SECTION] Setup Utils
 // [SECTION] Formatter
@@ -43,6 +44,22 @@
 #define IMPLOT3D_LABEL_FORMAT "%g"
 // Max character size for tick labels
 #define IMPLOT3D_LABEL_MAX_SIZE 32
+// Max number of jobs an item is split into when tessellated in parallel
+#define IMPLOT3D_MAX_JOBS 64
+// Meshes with fewer triangles are not simplified by ImPlot3DMeshFlags_LOD, and simplified levels stop at about this size
+#define IMPLOT3D_MESH_LOD_MIN_TRIANGLES 4096
+// Squared pixels of the projected mesh bounding box diagonal per rendered triangle when picking a simplified level
+#define IMPLOT3D_MESH_LOD_PIXELS_PER_TRIANGLE 4.0f
+// Frames a cached simplified mesh is kept after it was last plotted
+#define IMPLOT3D_MESH_LOD_KEEP_FRAMES 120
+// Frames a cached isosurface is kept after it was last plotted
+#define IMPLOT3D_ISOSURFACE_KEEP_FRAMES 120
+// Minimum number of volume cells per job when extracting an isosurface in parallel
+#define IMPLOT3D_ISOSURFACE_MIN_JOB_CELLS 65536
+// Frames the cached faces of a voxel grid are kept after it was last plotted
+#define IMPLOT3D_VOXELS_KEEP_FRAMES 120
+// Frames the cached vertex normals of a shaded item are kept after it was last plotted
+#define IMPLOT3D_NORMALS_KEEP_FRAMES 120
 
 //-----------------------------------------------------------------------------
 // [SECTION] Generic Helpers
@@ -93,6 +110,20 @@ static inline ImU32 ImMixU32(ImU32 a, ImU32 b, ImU32 s) {
 #endif
 }
 
+// Returns an empty box, which is replaced by the first point it is expanded with
+static inline ImPlot3DBox ImEmptyBox() {
+    return ImPlot3DBox(ImPlot3DPoint(HUGE_VAL, HUGE_VAL, HUGE_VAL), ImPlot3DPoint(-HUGE_VAL, -HUGE_VAL, -HUGE_VAL));
+}
+// Expands a box to contain a point, skipping its NaN/Inf coordinates
+static inline void ImExpandBox(ImPlot3DBox& box, const ImPlot3DPoint& point) {
+    for (int i = 0; i < 3; i++) {
+        if (!ImNanOrInf(point[i])) {
+            box.Min[i] = ImMin(box.Min[i], point[i]);
+            box.Max[i] = ImMax(box.Max[i], point[i]);
+        }
+    }
+}
+
 // Fills a buffer with n samples linear interpolated from vmin to vmax
 template <typename T> void FillRange(ImVector<T>& buffer, int n, T vmin, T vmax) {
     buffer.resize(n);
@@ -109,6 +140,7 @@ template <typename T> void FillRange(ImVector<T>& buffer, int n, T vmin, T vmax)
 //-----------------------------------------------------------------------------
 
 struct ImPlot3DTicker;
+struct ImPlot3DThreadPool; // Workers of the built-in parallel for, defined in implot3d.cpp
 
 //------------------------------------------------------------------------------
 // [SECTION] Callbacks
@@ -127,6 +159,18 @@ struct ImDrawList3D {
         unsigned int VtxIdx;
     };
 
+    // [Internal] Draw command of the sorted output, one per texture change
+    struct ImDrawCmd3D {
+        ImTextureRef TexRef;    // Texture of the command (ImTextureID(0) for the default texture)
+        unsigned int ElemCount; // Number of indices
+    };
+
+    // [Internal] Depth of a triangle, sorted by SortedMoveToImGuiDrawList()
+    struct ImDrawTriRef {
+        float Z;    // Depth of the triangle
+        int TriIdx; // Index of the triangle in ZBuffer
+    };
+
     ImVector<ImDrawIdx> IdxBuffer;  // Index buffer
     ImVector<ImDrawVert> VtxBuffer; // Vertex buffer
     ImVector<float> ZBuffer;        // Z buffer. Depth value for each triangle
@@ -138,9 +182,24 @@ struct ImDrawList3D {
     ImVector<ImTextureBufferItem> _TextureBuffer; // [Internal] buffer for SetTexture/ResetTexture
     ImDrawListSharedData* _SharedData;            // [Internal] shared draw list data
 
+    // Output of the last SortedMoveToImGuiDrawList(), kept so it can be reused when the plot did not change
+    ImVector<ImDrawIdx> _LastIdxBuffer;               // [Internal] unsorted indices of the last output
+    ImVector<ImDrawVert> _LastVtxBuffer;              // [Internal] vertices of the last output
+    ImVector<float> _LastZBuffer;                     // [Internal] depth of each triangle of the last output
+    ImVector<ImTextureBufferItem> _LastTextureBuffer; // [Internal] texture buffer of the last output
+    ImVector<ImDrawIdx> _LastSortedIdxBuffer;         // [Internal] indices of the last output sorted by depth
+    ImVector<ImDrawCmd3D> _LastCmdBuffer;             // [Internal] draw commands of the last output
+    ImVector<ImDrawTriRef> _SortScratch;              // [Internal] scratch of the depth sort, kept between frames
+
+    // Buffers keep their capacity between frames and are only trimmed after staying mostly unused for a while
+    int _TrimFrameCount; // [Internal] number of consecutive frames in which the buffers were mostly unused
+    int _TrimPeakVtx;    // [Internal] maximum number of vertices used during these frames
+    int _TrimPeakIdx;    // [Internal] maximum number of indices used during these frames
+
     ImDrawList3D() {
         _Flags = ImDrawListFlags_None;
         _SharedData = nullptr;
+        _TrimFrameCount = _TrimPeakVtx = _TrimPeakIdx = 0;
         ResetBuffers();
     }
 
@@ -150,17 +209,27 @@ struct ImDrawList3D {
     void SetTexture(ImTextureRef tex_ref);
     void ResetTexture();
 
+    // Sort the triangles by depth, move them to the ImGui draw list and keep them as the last output
     void SortedMoveToImGuiDrawList();
-
+    // Append the last output to the ImGui draw list again
+    void AppendLastToImGuiDrawList();
+    // Copy the first vtx_count vertices and idx_count indices of the last output back into the (empty) buffers
+    void RestoreLast(int vtx_count, int idx_count);
+    // Shrink the buffers once the last output used less than fraction of their capacity for frame_count consecutive frames
+    void TrimUnused(int frame_count, float fraction);
+    // Bytes allocated by the buffers
+    size_t CalcMemoryUsage() const;
+
+    // Empty the buffers, keeping their capacity
     void ResetBuffers() {
-        IdxBuffer.clear();
-        VtxBuffer.clear();
-        ZBuffer.clear();
+        IdxBuffer.resize(0);
+        VtxBuffer.resize(0);
+        ZBuffer.resize(0);
         _VtxCurrentIdx = 0;
         _VtxWritePtr = VtxBuffer.Data;
         _IdxWritePtr = IdxBuffer.Data;
         _ZWritePtr = ZBuffer.Data;
-        _TextureBuffer.clear();
+        _TextureBuffer.resize(0);
         ResetTexture();
     }
 
@@ -181,6 +250,12 @@ struct ImPlot3DNextItemData {
     bool IsAutoFill;
     bool IsAutoLine;
     bool Hidden;
+    ImU64 DataVersion;         // User provided version of the item data (0 if unversioned)
+    ImU64 SourceVersion;       // Version of the data the library keeps for the item (e.g. registered mesh), 0 if none. See NewSourceVersion()
+    double DataScale[3];       // Decoding of the item data along each axis (value * DataScale + DataOffset)
+    double DataOffset[3];      // See DataScale
+    ImPlot3DItemHandle Handle; // Handle of the next item (ID 0 to register the item by label)
+    int TriangleBudget;        // Maximum number of triangles of the next mesh with ImPlot3DMeshFlags_LOD (0 for no budget)
 
     ImPlot3DNextItemData() { Reset(); }
 
@@ -199,6 +274,14 @@ struct ImPlot3DNextItemData {
         IsAutoFill = true;
         IsAutoLine = true;
         Hidden = false;
+        DataVersion = 0;
+        SourceVersion = 0;
+        for (int i = 0; i < 3; i++) {
+            DataScale[i] = 1.0;
+            DataOffset[i] = 0.0;
+        }
+        Handle = ImPlot3DItemHandle();
+        TriangleBudget = 0;
     }
 };
 
@@ -309,11 +392,44 @@ struct ImPlot3DColormapData {
     }
 };
 
+// Maps values in [min, max] to the entries of a colormap table with an integer index, picking the entries as LerpTable() does. Values outside
+// the range are clamped and NaN values take the first entry
+struct ImPlot3DColormapLUT {
+    const ImU32* Table;
+    int MaxEntry;
+    double Min;
+    double Scale; // Table entries per unit of value
+    double Round; // 0.5 to pick the nearest entry of continuous colormaps, 0 for the bins of qualitative colormaps
+
+    ImPlot3DColormapLUT() {
+        Table = nullptr;
+        MaxEntry = 0;
+        Min = Scale = Round = 0.0;
+    }
+    ImPlot3DColormapLUT(const ImPlot3DColormapData& data, ImPlot3DColormap cmap, double min, double max) {
+        const bool qual = data.IsQual(cmap);
+        Table = data.GetTable(cmap);
+        MaxEntry = data.GetTableSize(cmap) - 1;
+        Min = min;
+        Scale = max > min ? (qual ? MaxEntry + 1 : MaxEntry) / (max - min) : 0.0;
+        Round = qual ? 0.0 : 0.5;
+    }
+
+    inline int GetIndex(double value) const {
+        // NaN values fail the first test and take the first entry
+        const double entry = (value - Min) * Scale + Round;
+        return entry > 0.0 ? (entry < MaxEntry ? (int)entry : MaxEntry) : 0;
+    }
+    inline ImU32 operator()(double value) const { return Table[GetIndex(value)]; }
+};
+
 // State information for plot items
 struct ImPlot3DItem {
     ImGuiID ID;
     ImU32 Color;
-    int NameOffset;
+    int NameOffset;  // Offset of the label in the legend labels, kept between frames (-1 if none)
+    float NameWidth; // Width of the displayed label (-1 if not measured yet)
+    bool NameShown;  // Whether the label has a displayed part (i.e. before "##")
     bool Show;
     bool LegendHovered;
     bool SeenThisFrame;
@@ -322,6 +438,8 @@ struct ImPlot3DItem {
         ID = 0;
         Color = IM_COL32_WHITE;
         NameOffset = -1;
+        NameWidth = -1.0f;
+        NameShown = false;
         Show = true;
         LegendHovered = false;
         SeenThisFrame = false;
@@ -335,22 +453,29 @@ struct ImPlot3DLegend {
     ImPlot3DLegendFlags PreviousFlags;
     ImPlot3DLocation Location;
     ImPlot3DLocation PreviousLocation;
-    ImVector<int> Indices;
-    ImGuiTextBuffer Labels;
+    ImVector<int> Indices;         // Items in the legend this frame
+    ImGuiTextBuffer Labels;        // Labels of the items, only appended when an item label changes
+    ImGuiTextBuffer LabelsScratch; // Scratch used to compact Labels
+    int LabelsGarbage;             // Bytes of Labels no longer referenced by any item
+    ImFont* NameWidthFont;         // Font used to measure the item labels
+    float NameWidthFontSize;       // Font size used to measure the item labels
     ImRect Rect;
+    float Scroll;    // Vertical scroll of the legend entries, in pixels
+    bool Scrollable; // Whether the entries did not fit in the plot and can be scrolled with the mouse wheel
     bool Hovered;
     bool Held;
 
     ImPlot3DLegend() {
         PreviousFlags = Flags = ImPlot3DLegendFlags_None;
-        Hovered = Held = false;
+        LabelsGarbage = 0;
+        NameWidthFont = nullptr;
+        NameWidthFontSize = 0.0f;
+        Scroll = 0.0f;
+        Scrollable = Hovered = Held = false;
         PreviousLocation = Location = ImPlot3DLocation_NorthWest;
     }
 
-    void Reset() {
-        Indices.shrink(0);
-        Labels.Buf.shrink(0);
-    }
+    void Reset() { Indices.shrink(0); }
 };
 
 // Holds items
@@ -371,9 +496,19 @@ struct ImPlot3DItemGroup {
     int GetLegendCount() const { return Legend.Indices.size(); }
     ImPlot3DItem* GetLegendItem(int i) { return ItemPool.GetByIndex(Legend.Indices[i]); }
     const char* GetLegendLabel(int i) { return Legend.Labels.Buf.Data + GetLegendItem(i)->NameOffset; }
+    float GetLegendLabelWidth(int i) {
+        ImPlot3DItem* item = GetLegendItem(i);
+        if (item->NameWidth < 0.0f)
+            item->NameWidth = ImGui::CalcTextSize(Legend.Labels.Buf.Data + item->NameOffset, nullptr, true).x;
+        return item->NameWidth;
+    }
+    void SetItemLabel(ImPlot3DItem* item, const char* label_id);
+    void CompactLabels();
     void Reset() {
         ItemPool.Clear();
         Legend.Reset();
+        Legend.Labels.Buf.shrink(0);
+        Legend.LabelsGarbage = 0;
         ColormapIdx = 0;
     }
 };
@@ -424,6 +559,22 @@ struct ImPlot3DTicker {
         return AddTick(tick);
     }
 
+    // Format the labels of the ticks starting at idx0 that are shown and have no label yet
+    void FormatLabels(int idx0, ImPlot3DFormatter formatter, void* data) {
+        if (formatter == nullptr)
+            return;
+        char buff[IMPLOT3D_LABEL_MAX_SIZE];
+        for (int i = idx0; i < Ticks.Size; i++) {
+            ImPlot3DTick& tick = Ticks[i];
+            if (!tick.ShowLabel || tick.TextOffset != -1)
+                continue;
+            tick.TextOffset = TextBuffer.size();
+            formatter(tick.PlotPos, buff, sizeof(buff), data);
+            TextBuffer.append(buff, buff + strlen(buff) + 1);
+            tick.LabelSize = ImGui::CalcTextSize(TextBuffer.Buf.Data + tick.TextOffset);
+        }
+    }
+
     inline ImPlot3DTick& AddTick(ImPlot3DTick tick) {
         tick.Idx = Ticks.size();
         Ticks.push_back(tick);
@@ -450,7 +601,10 @@ struct ImPlot3DAxis {
     ImPlot3DCond RangeCond;
     ImGuiTextBuffer Label;
     // Ticks
-    ImPlot3DTicker Ticker;
+    ImPlot3DTicker Ticker;       // Ticks of the axis, only rebuilt when TickerHash changes
+    ImPlot3DTicker CustomTicker; // Custom ticks set with SetupAxisTicks() in the current frame (labels are formatted in Ticker)
+    ImGuiID CustomTicksHash;     // Hash of the custom ticks set in the current frame
+    ImGuiID TickerHash;          // Hash of the range, pixel size, formatter, locator and custom ticks used to build Ticker
     ImPlot3DFormatter Formatter;
     void* FormatterData;
     ImPlot3DLocator Locator;
@@ -473,6 +627,8 @@ struct ImPlot3DAxis {
         Range.Max = 1.0f;
         RangeCond = ImPlot3DCond_None;
         // Ticks
+        CustomTicksHash = 0;
+        TickerHash = 0;
         Formatter = nullptr;
         FormatterData = nullptr;
         Locator = nullptr;
@@ -491,7 +647,8 @@ struct ImPlot3DAxis {
     inline void Reset() {
         RangeCond = ImPlot3DCond_None;
         // Ticks
-        Ticker.Reset();
+        CustomTicker.Reset();
+        CustomTicksHash = 0;
         Formatter = nullptr;
         FormatterData = nullptr;
         Locator = nullptr;
@@ -612,6 +769,164 @@ struct ImPlot3DAxis {
     void ApplyFit();
 };
 
+// Position of an item output in the plot 3D draw list
+struct ImPlot3DItemOutput {
+    ImGuiID Hash;  // Hash of the item ID, data version and style
+    int VtxOffset; // Size of the vertex buffer when the item started rendering
+    int IdxOffset; // Size of the index buffer when the item started rendering
+};
+
+// Cache of rotated glyph quads, so repeated text only needs to be translated and copied into the draw list
+struct ImPlot3DTextCache {
+    struct Entry {
+        ImGuiID Key;    // Hash of the text, font, font size and angle
+        int TextOffset; // Offset of the text in Text
+        int TextLength; // Length of the text
+        int VtxOffset;  // Offset of the first glyph vertex in Vtx
+        int VtxCount;   // Number of glyph vertices (4 per glyph)
+        int LastFrame;  // Last ImGui frame in which the entry was used
+    };
+    ImVector<Entry> Entries;
+    ImGuiStorage Map;         // Key -> index in Entries + 1
+    ImVector<char> Text;      // Texts of the entries, compared on lookup so that colliding keys aren't mistaken for each other
+    ImVector<ImDrawVert> Vtx; // Glyph quad corners relative to the text position and their UVs
+    int UsedVtxCount;         // Number of vertices used in the current frame
+
+    ImPlot3DTextCache() { UsedVtxCount = 0; }
+
+    // Returns the entry of the key, or nullptr if there is none. Sets collision if the entry holds another text with the same key
+    inline Entry* GetEntry(ImGuiID key, const char* text_begin, const char* text_end, bool* collision) {
+        int idx = Map.GetInt(key, 0);
+        *collision = false;
+        if (idx == 0)
+            return nullptr;
+        Entry& entry = Entries[idx - 1];
+        const int length = (int)(text_end - text_begin);
+        if (entry.TextLength != length || memcmp(Text.Data + entry.TextOffset, text_begin, (size_t)length) != 0) {
+            *collision = true;
+            return nullptr;
+        }
+        return &entry;
+    }
+    inline Entry* AddEntry(const Entry& entry) {
+        Entries.push_back(entry);
+        Map.SetInt(entry.Key, Entries.Size);
+        return &Entries.back();
+    }
+    inline void MarkUsed(Entry& entry) {
+        int frame = ImGui::GetFrameCount();
+        if (entry.LastFrame != frame) {
+            entry.LastFrame = frame;
+            UsedVtxCount += entry.VtxCount;
+        }
+    }
+    // Drops the entries not used in the current frame once they take most of the cache
+    void GarbageCollect();
+};
+
+// Simplified levels of a mesh, built by quadric error edge collapses. Collapses keep one of the two vertices, so the levels reuse the mesh
+// vertices and only store indices
+struct ImPlot3DMeshLOD {
+    struct Level {
+        int IdxOffset; // Offset of the level in Indices
+        int IdxCount;  // Number of indices of the level
+    };
+    ImGuiID Key;                    // Hash of the mesh pointers, counts and data version
+    ImVector<unsigned int> Indices; // Indices of every level, from the finest to the coarsest
+    ImVector<Level> Levels;         // Levels, each with about a quarter of the triangles of the previous one
+    ImPlot3DPoint BoundsMin;        // Bounding box of the mesh
+    ImPlot3DPoint BoundsMax;        // See BoundsMin
+    int LastFrame;                  // Last ImGui frame in which the mesh was plotted (-1 if the levels were not built yet)
+
+    ImPlot3DMeshLOD() {
+        Key = 0;
+        LastFrame = -1;
+    }
+};
+
+// Mesh registered with CreateMesh(). Everything derived from its triangles is computed once, only the projection of its vertices is updated
+// every time it is plotted
+struct ImPlot3DMesh {
+    ImGuiID ID;                         // Mesh ID, also the key of the mesh in the context pool
+    ImVector<ImPlot3DPoint> Vertices;   // Vertex positions
+    ImVector<unsigned int> Indices;     // Three vertex indices per triangle
+    ImVector<unsigned int> Edges;       // Two vertex indices per unique edge, rendered once even when shared by two triangles
+    ImVector<int> Adjacency;            // Triangle across edge k (vertices k and k+1) of each triangle, -1 for open edges
+    ImVector<unsigned int> WeldSources; // Index in the vertices given to UpdateMeshVertices() of each vertex (empty if not welded)
+    int SourceVtxCount;                 // Number of vertices expected by UpdateMeshVertices()
+    ImPlot3DBox Bounds;                 // Bounding box of the vertices, fitted instead of every vertex
+    ImU64 Version;                      // New source version each time the vertices change (see NewSourceVersion())
+    ImPlot3DMeshLOD LOD;                // Simplified levels, built the first time the mesh is plotted with ImPlot3DMeshFlags_LOD
+    ImVector<ImVec2> ProjectedPixels;   // Pixel position of each vertex in the plot being rendered
+    ImVector<float> ProjectedDepths;    // Depth of each vertex in the plot being rendered
+    ImVector<bool> ProjectedInside;     // Whether each vertex is inside the culling box of the plot being rendered
+    ImVector<ImPlot3DPoint> Normals;    // Vertex normals, computed the first time the mesh is plotted with ImPlot3DMeshFlags_Shaded
+    ImU64 NormalsVersion;               // Version of the vertices when the normals were computed
+
+    ImPlot3DMesh() {
+        ID = 0;
+        SourceVtxCount = 0;
+        Version = 0;
+        NormalsVersion = 0;
+    }
+};
+
+// Triangles of an isosurface extracted by PlotIsosurface(), extracted again when the volume data version, iso value or bounds change
+struct ImPlot3DIsosurface {
+    ImGuiID Key;                      // Hash of the plot, item, volume pointer and volume size
+    ImU64 DataVersion;                // Data version of the volume when the triangles were extracted
+    double Iso;                       // Iso value of the triangles
+    ImPlot3DBox Bounds;               // Bounds of the volume
+    ImU64 Version;                    // New source version on each extraction (see NewSourceVersion())
+    ImVector<ImPlot3DPoint> Vertices; // Vertices on the crossed edges of the volume cells
+    ImVector<unsigned int> Indices;   // Three vertex indices per triangle
+    int LastFrame;                    // Last ImGui frame in which the isosurface was plotted (-1 if it was not extracted yet)
+
+    ImPlot3DIsosurface() {
+        Key = 0;
+        DataVersion = 0;
+        Iso = 0.0;
+        Version = 0;
+        LastFrame = -1;
+    }
+};
+
+// Faces of a voxel grid extracted by PlotVoxels(), extracted again when the grid data version or bounds change
+struct ImPlot3DVoxels {
+    ImGuiID Key;                      // Hash of the plot, item, grid pointer and grid size
+    ImU64 DataVersion;                // Data version of the grid when the faces were extracted
+    ImPlot3DBox Bounds;               // Bounds of the grid
+    ImU64 Version;                    // New source version on each extraction (see NewSourceVersion())
+    ImVector<ImPlot3DPoint> Vertices; // Four corners per merged face, grouped by direction (-x, +x, -y, +y, -z, +z)
+    int FaceOffsets[7];               // First face of each direction, FaceOffsets[6] is the number of faces
+    int LastFrame;                    // Last ImGui frame in which the grid was plotted (-1 if it was not extracted yet)
+
+    ImPlot3DVoxels() {
+        Key = 0;
+        DataVersion = 0;
+        Version = 0;
+        for (int i = 0; i < 7; i++)
+            FaceOffsets[i] = 0;
+        LastFrame = -1;
+    }
+};
+
+// Vertex normals of a shaded item, computed again when the item data version changes
+struct ImPlot3DNormals {
+    ImGuiID Key;                     // Hash of the plot, item, data (if versioned), data size and data scale
+    ImU64 DataVersion;               // Data version of the item when the normals were computed
+    ImU64 SourceVersion;             // Source version of the item when the normals were computed
+    ImVector<ImPlot3DPoint> Normals; // Unit normal of each vertex, in plot coordinates
+    int LastFrame;                   // Last ImGui frame in which the item was plotted (-1 if the normals were not computed yet)
+
+    ImPlot3DNormals() {
+        Key = 0;
+        DataVersion = 0;
+        SourceVersion = 0;
+        LastFrame = -1;
+    }
+};
+
 // Holds plot state information that must persist after EndPlot
 struct ImPlot3DPlot {
     ImGuiID ID;
@@ -645,6 +960,21 @@ struct ImPlot3DPlot {
     ImPlot3DItemGroup Items;
     // 3D draw list
     ImDrawList3D DrawList;
+    // Text
+    ImPlot3DTextCache TextCache; // Rotated glyph quads of the tick, axis and item labels
+    // Output reuse
+    ImGuiID ViewHash;                             // Hash of everything that affects how items are projected in the current frame
+    ImGuiID LastViewHash;                         // View hash of the last output
+    ImVector<ImPlot3DItemOutput> ItemOutputs;     // Items rendered in the current frame
+    ImVector<ImPlot3DItemOutput> LastItemOutputs; // Items rendered in the last output
+    bool LastOutputValid;                         // True if the draw list holds an output that can be reused
+    bool ReusingOutput;                           // True while every item of the current frame matches the last output
+    // Dirty state
+    ImGuiID ItemsHash;        // Combined hash of the items submitted in the current frame
+    ImGuiID LastFrameHash;    // Combined view and items hash of the last frame
+    bool HasUnversionedItems; // True if an item without data version was submitted in the current frame
+    bool Dirty;               // True if the plot changed in the last frame or will change in the next frame without user input
+    int LastFrameActive;      // Last ImGui frame in which the plot was submitted
     // Misc
     bool ContextClick; // True if context button was clicked (to distinguish from double click)
     bool OpenContextThisFrame;
@@ -666,6 +996,13 @@ struct ImPlot3DPlot {
         HeldEdgeIdx = -1;
         HeldPlaneIdx = -1;
         FitThisFrame = true;
+        ViewHash = LastViewHash = 0;
+        LastOutputValid = false;
+        ReusingOutput = false;
+        ItemsHash = LastFrameHash = 0;
+        HasUnversionedItems = false;
+        Dirty = true;
+        LastFrameActive = -1;
         ContextClick = false;
         OpenContextThisFrame = false;
     }
@@ -685,6 +1022,10 @@ struct ImPlot3DPlot {
     ImPlot3DPoint RangeCenter() const;
     void SetRange(const ImPlot3DPoint& min, const ImPlot3DPoint& max);
     float GetBoxZoom() const;
+    ImGuiID CalcViewHash() const;
+    void RestoreLastOutput(int item_count);
+    // Bytes allocated by the plot draw list, text cache and item outputs
+    size_t CalcMemoryUsage() const;
 };
 
 struct ImPlot3DContext {
@@ -698,6 +1039,26 @@ struct ImPlot3DContext {
     ImVector<ImGuiStyleMod> StyleModifiers;
     ImVector<ImPlot3DColormap> ColormapModifiers;
     ImPlot3DColormapData ColormapData;
+    // Parallel tessellation
+    ImPlot3DParallelFor ParallelFor;              // User parallel for (nullptr to use the built-in one)
+    void* ParallelForUserData;                    // User data passed to ParallelFor
+    int ParallelMaxJobs;                          // Maximum number of jobs per item (0 for the number of hardware threads)
+    ImDrawList3D JobDrawLists[IMPLOT3D_MAX_JOBS]; // Write cursors of the jobs into the plot draw list
+    ImPlot3DThreadPool* ThreadPool;               // Workers of the built-in parallel for, started on first use
+    // Memory
+    int DrawListTrimFrames;      // Frames a plot draw list must stay mostly unused before being trimmed (0 to never trim)
+    float DrawListTrimFraction;  // Fraction of the capacity below which a draw list is considered mostly unused
+    ImVector<double> TempDouble; // Scratch of SetupAxisTicks()
+    ImVector<ImU32> TempColors;  // Scratch of the vertex colors of the item being rendered
+    ImVector<ImU32> TempShades;  // Scratch of the vertex shades of the item being rendered
+    // Meshes
+    ImPool<ImPlot3DMeshLOD> MeshLODs;       // Simplified levels of the meshes plotted with ImPlot3DMeshFlags_LOD
+    ImPool<ImPlot3DMesh> Meshes;            // Meshes registered with CreateMesh()
+    ImGuiID LastMeshID;                     // ID of the last mesh created
+    ImPool<ImPlot3DIsosurface> Isosurfaces; // Triangles extracted by PlotIsosurface()
+    ImPool<ImPlot3DVoxels> Voxels;          // Faces extracted by PlotVoxels()
+    ImPool<ImPlot3DNormals> Normals;        // Vertex normals of the items plotted with a Shaded flag
+    int LastGarbageCollectFrame;            // Last ImGui frame in which the caches above were garbage collected
 };
 
 //-----------------------------------------------------------------------------
@@ -707,8 +1068,12 @@ struct ImPlot3DContext {
 namespace ImPlot3D {
 
 #ifndef GImPlot3D
+#ifdef IMPLOT3D_THREAD_LOCAL_CONTEXT
+extern thread_local ImPlot3DContext* GImPlot3D; // Current context pointer (one per thread)
+#else
 extern IMPLOT3D_API ImPlot3DContext* GImPlot3D; // Current context pointer
 #endif
+#endif
 
 //-----------------------------------------------------------------------------
 // [SECTION] Context Utils
@@ -717,6 +1082,24 @@ extern IMPLOT3D_API ImPlot3DContext* GImPlot3D; // Current context pointer
 IMPLOT3D_API void InitializeContext(ImPlot3DContext* ctx); // Initialize ImPlot3DContext
 IMPLOT3D_API void ResetContext(ImPlot3DContext* ctx);      // Reset ImPlot3DContext
 
+// Returns the maximum number of jobs an item can be split into
+IMPLOT3D_API int GetParallelJobCount();
+// Calls job(i, job_data) for each i in [0, count) using the context parallel for, and returns once all jobs are done
+IMPLOT3D_API void ParallelFor(int count, ImPlot3DJob job, void* job_data);
+// Stops the workers of the built-in parallel for of a context
+IMPLOT3D_API void DestroyThreadPool(ImPlot3DContext* ctx);
+
+// Wraps the ImGui allocator to count the allocations made from then on (e.g. to check that steady frames do not allocate). The ImGui
+// allocator must not be replaced while counting. Only allocations through the ImGui allocator are counted: the workers of the built-in
+// parallel for are started on first use and then reused, so they don't allocate in steady frames either
+IMPLOT3D_API void SetAllocationCounting(bool enabled);
+// Returns the number of allocations made through the ImGui allocator since counting was enabled
+IMPLOT3D_API int GetAllocationCount();
+
+// Returns a new version for data that the library identifies by version (streams, command lists...). Versions are unique across all
+// contexts and threads, so two objects never share one. Thread-safe
+IMPLOT3D_API ImU64 NewSourceVersion();
+
 //-----------------------------------------------------------------------------
 // [SECTION] Style Utils
 //-----------------------------------------------------------------------------
@@ -761,9 +1144,41 @@ IMPLOT3D_API ImPlot3DItem* GetCurrentItem();
 // Busts the cache for every item for every plot in the current context
 IMPLOT3D_API void BustItemCache();
 
+// Returns true if the current item matches the last output of the plot and does not need to be rendered again
+IMPLOT3D_API bool ReuseItemOutput(int count, ImPlot3DItemFlags flags);
+
 // TODO move to another place
 IMPLOT3D_API void AddTextRotated(ImDrawList* draw_list, ImVec2 pos, float angle, ImU32 col, const char* text_begin, const char* text_end = nullptr);
 
+//-----------------------------------------------------------------------------
+// [SECTION] Mesh Utils
+//-----------------------------------------------------------------------------
+
+// Welds vertices closer than tolerance (0: identical positions) using a hash grid. Writes to remap[i] the index of the unique vertex of
+// vertex i and returns the number of unique vertices. Unique vertices are numbered in the order of their first occurrence. Doesn't allocate
+// through ImGui, so it can run on any thread (see ImPlot3DVector)
+IMPLOT3D_API int CalcWeldRemap(const ImPlot3DPoint* vtx, int vtx_count, float tolerance, unsigned int* remap);
+
+// Builds the simplified levels of a mesh, each with about a quarter of the triangles of the previous one
+IMPLOT3D_API void BuildMeshLOD(ImPlot3DMeshLOD& lod, const ImPlot3DPoint* vtx, int vtx_count, const unsigned int* idx, int idx_count);
+// Returns the cached simplified levels of a mesh, building them the first time the mesh is plotted
+IMPLOT3D_API ImPlot3DMeshLOD* GetMeshLOD(const ImPlot3DPoint* vtx, int vtx_count, const unsigned int* idx, int idx_count);
+// Returns the level to render in the current plot given the size of the mesh in pixels and the triangle budget (-1 for the full mesh)
+IMPLOT3D_API int SelectMeshLODLevel(const ImPlot3DMeshLOD& lod, int idx_count, int triangle_budget);
+// Drops the simplified levels of the meshes that were not plotted in the last IMPLOT3D_MESH_LOD_KEEP_FRAMES frames
+IMPLOT3D_API void GarbageCollectMeshLODs();
+
+// Computes the unique edges and the triangle adjacency of a registered mesh from its indices
+IMPLOT3D_API void BuildMeshTopology(ImPlot3DMesh& mesh);
+// Returns the mesh of a handle, or nullptr if it was destroyed
+IMPLOT3D_API ImPlot3DMesh* GetMesh(ImPlot3DMeshHandle handle);
+// Drops the isosurfaces that were not plotted in the last IMPLOT3D_ISOSURFACE_KEEP_FRAMES frames
+IMPLOT3D_API void GarbageCollectIsosurfaces();
+// Drops the voxel grids that were not plotted in the last IMPLOT3D_VOXELS_KEEP_FRAMES frames
+IMPLOT3D_API void GarbageCollectVoxels();
+// Drops the vertex normals of the items that were not plotted in the last IMPLOT3D_NORMALS_KEEP_FRAMES frames
+IMPLOT3D_API void GarbageCollectNormals();
+
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Utils
 //-----------------------------------------------------------------------------
@@ -783,6 +1198,10 @@ IMPLOT3D_API ImPlot3DPoint PlotToNDC(const ImPlot3DPoint& point);
 IMPLOT3D_API ImPlot3DPoint NDCToPlot(const ImPlot3DPoint& point);
 // Convert a position in the current plot's NDC to pixels
 IMPLOT3D_API ImVec2 NDCToPixels(const ImPlot3DPoint& point);
+// Same conversions for a given plot. They don't read the current context, so they can be used by tessellation jobs
+IMPLOT3D_API ImPlot3DPoint PlotToNDC(const ImPlot3DPlot& plot, const ImPlot3DPoint& point);
+IMPLOT3D_API ImVec2 NDCToPixels(const ImPlot3DPlot& plot, const ImPlot3DPoint& point);
+IMPLOT3D_API ImVec2 PlotToPixels(const ImPlot3DPlot& plot, const ImPlot3DPoint& point);
 // Convert a pixel coordinate to a ray in the NDC
 IMPLOT3D_API ImPlot3DRay PixelsToNDCRay(const ImVec2& pix);
 // Convert a ray in the NDC to a ray in the current plot's coordinate system
@@ -0,0 +1,1069 @@
+//--------------------------------------------------
+// ImPlot3D v0.3 WIP
+// implot3d_io.cpp
+// Date: 2026-10-18
+// Author: Breno Cunha Queiroz (brenocq.com)
+//
+// Acknowledgments:
+//  ImPlot3D is heavily inspired by ImPlot
+//  (https://github.com/epezent/implot) by Evan Pezent,
+//  and follows a similar code style and structure to
+//  maintain consistency with ImPlot's API.
+//--------------------------------------------------
+
+// Table of Contents:
+// [SECTION] Includes
+// [SECTION] File Formats
+// [SECTION] Text Parsing
+// [SECTION] ImPlot3DColumn
+// [SECTION] ImPlot3DDataFile
+// [SECTION] SaveColumns
+// [SECTION] Mesh Loaders
+// [SECTION] Plot Items
+
+//-----------------------------------------------------------------------------
+// [SECTION] Includes
+//-----------------------------------------------------------------------------
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+
+#include "implot3d_io.h"
+#ifndef IMGUI_DISABLE
+#include "implot3d_internal.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// [SECTION] File Formats
+//-----------------------------------------------------------------------------
+
+// ImPlot3D column file (little-endian):
+// - Header: char Magic[8] = "IMPLOT3D", ImU32 Version = 1, ImU32 ColumnCount, ImU64 RowCount
+// - ColumnCount column headers: ImU32 Type (ImGuiDataType), ImU32 Stride, ImU64 Offset (from the file start), char Name[32]
+// - Column data anywhere after the headers (SaveColumns() writes each column contiguously, aligned to 64 bytes)
+static const char COLUMN_FILE_MAGIC[8] = {'I', 'M', 'P', 'L', 'O', 'T', '3', 'D'};
+static const ImU32 COLUMN_FILE_VERSION = 1;
+static const size_t COLUMN_FILE_HEADER_SIZE = 24;
+static const size_t COLUMN_HEADER_SIZE = 48;
+static const size_t COLUMN_FILE_ALIGNMENT = 64;
+
+static const char NPY_MAGIC[6] = {'\x93', 'N', 'U', 'M', 'P', 'Y'};
+
+static ImU32 ReadU32(const unsigned char* p) { return (ImU32)p[0] | ((ImU32)p[1] << 8) | ((ImU32)p[2] << 16) | ((ImU32)p[3] << 24); }
+static ImU64 ReadU64(const unsigned char* p) { return (ImU64)ReadU32(p) | ((ImU64)ReadU32(p + 4) << 32); }
+
+static int DataTypeSize(ImGuiDataType type) {
+    switch (type) {
+        case ImGuiDataType_S8:
+        case ImGuiDataType_U8: return 1;
+        case ImGuiDataType_S16:
+        case ImGuiDataType_U16: return 2;
+        case ImGuiDataType_S32:
+        case ImGuiDataType_U32:
+        case ImGuiDataType_Float: return 4;
+        case ImGuiDataType_S64:
+        case ImGuiDataType_U64:
+        case ImGuiDataType_Double: return 8;
+        default: return 0;
+    }
+}
+
+// Parses a NPY descr such as '<f4' or '|u1'
+static bool ParseNpyDescr(const char* descr, int len, ImGuiDataType* type) {
+    if (len < 3 || descr[0] == '>')
+        return false;
+    const char kind = descr[1];
+    const int size = atoi(descr + 2);
+    if (kind == 'f' && size == 4)
+        *type = ImGuiDataType_Float;
+    else if (kind == 'f' && size == 8)
+        *type = ImGuiDataType_Double;
+    else if (kind == 'i')
+        *type = size == 1 ? ImGuiDataType_S8 : size == 2 ? ImGuiDataType_S16 : size == 4 ? ImGuiDataType_S32 : ImGuiDataType_S64;
+    else if (kind == 'u' || kind == 'b')
+        *type = size == 1 ? ImGuiDataType_U8 : size == 2 ? ImGuiDataType_U16 : size == 4 ? ImGuiDataType_U32 : ImGuiDataType_U64;
+    else
+        return false;
+    return DataTypeSize(*type) == size;
+}
+
+// Returns the value of a key of the NPY header dictionary, e.g. "'<f4'" for 'descr'
+static const char* FindNpyValue(const char* header, const char* header_end, const char* key) {
+    const char* p = ImStristr(header, header_end, key, nullptr);
+    if (p == nullptr)
+        return nullptr;
+    p = (const char*)memchr(p, ':', header_end - p);
+    if (p == nullptr)
+        return nullptr;
+    for (p++; p < header_end && *p == ' '; p++) {}
+    return p < header_end ? p : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Text Parsing
+//-----------------------------------------------------------------------------
+
+static inline bool IsSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+static inline const char* SkipSpaces(const char* p, const char* end) {
+    while (p < end && IsSpace(*p))
+        p++;
+    return p;
+}
+
+// Returns the beginning of the next line
+static inline const char* SkipLine(const char* p, const char* end) {
+    p = (const char*)memchr(p, '\n', end - p);
+    return p != nullptr ? p + 1 : end;
+}
+
+// Returns the next token of the line and sets token_end to its end
+static const char* NextToken(const char* p, const char* line_end, const char** token_end) {
+    p = SkipSpaces(p, line_end);
+    const char* q = p;
+    while (q < line_end && !IsSpace(*q) && *q != '\n')
+        q++;
+    *token_end = q;
+    return p;
+}
+
+static bool TokenEquals(const char* token, const char* token_end, const char* str) {
+    return (size_t)(token_end - token) == strlen(str) && memcmp(token, str, token_end - token) == 0;
+}
+
+static void CopyToken(char* dst, int dst_size, const char* token, const char* token_end) {
+    const int len = ImMin((int)(token_end - token), dst_size - 1);
+    memcpy(dst, token, len);
+    dst[len] = '\0';
+}
+
+// Parses an integer after optional spaces. Returns the end of the number, or nullptr if there is none
+static const char* ParseInt(const char* p, const char* end, ImS64* out) {
+    p = SkipSpaces(p, end);
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+'))
+        negative = *p++ == '-';
+    const char* digits = p;
+    ImS64 value = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; p++)
+        value = value * 10 + (*p - '0');
+    if (p == digits)
+        return nullptr;
+    *out = negative ? -value : value;
+    return p;
+}
+
+// Parses a decimal number (e.g. -1.25e-3) after optional spaces, without the locale and null terminator requirements of strtod(). Returns
+// the end of the number, or nullptr if there is none
+static const char* ParseNumber(const char* p, const char* end, double* out) {
+    p = SkipSpaces(p, end);
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+'))
+        negative = *p++ == '-';
+    ImU64 mantissa = 0;
+    int exponent = 0;
+    int digits = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; p++, digits++) {
+        if (mantissa < 100000000000000000ull)
+            mantissa = mantissa * 10 + (*p - '0');
+        else
+            exponent++;
+    }
+    if (p < end && *p == '.') {
+        for (p++; p < end && *p >= '0' && *p <= '9'; p++, digits++) {
+            if (mantissa < 100000000000000000ull) {
+                mantissa = mantissa * 10 + (*p - '0');
+                exponent--;
+            }
+        }
+    }
+    if (digits == 0)
+        return nullptr;
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool negative_exponent = false;
+        if (q < end && (*q == '-' || *q == '+'))
+            negative_exponent = *q++ == '-';
+        const char* exponent_digits = q;
+        int e = 0;
+        for (; q < end && *q >= '0' && *q <= '9'; q++)
+            e = ImMin(e * 10 + (*q - '0'), 10000);
+        if (q > exponent_digits) {
+            exponent += negative_exponent ? -e : e;
+            p = q;
+        }
+    }
+    double value = (double)mantissa;
+    if (exponent > 0)
+        value *= ImPow(10.0, (double)exponent);
+    else if (exponent < 0)
+        value /= ImPow(10.0, (double)-exponent);
+    *out = negative ? -value : value;
+    return p;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DColumn
+//-----------------------------------------------------------------------------
+
+ImPlot3DColumn ImPlot3DColumn::Slice(ImS64 first, ImS64 count) const {
+    IM_ASSERT_USER_ERROR(first >= 0 && count >= 0 && first + count <= Count, "Slice out of the column!");
+    ImPlot3DColumn column = *this;
+    column.Data = (const unsigned char*)Data + first * Stride;
+    column.Count = count;
+    return column;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DDataFile
+//-----------------------------------------------------------------------------
+
+ImPlot3DDataFile::ImPlot3DDataFile() {
+    Error = nullptr;
+    _Data = nullptr;
+    _Size = 0;
+}
+
+ImPlot3DDataFile::~ImPlot3DDataFile() { Close(); }
+
+bool ImPlot3DDataFile::_Fail(const char* error) {
+    Close();
+    Error = error;
+    return false;
+}
+
+bool ImPlot3DDataFile::_Map(const char* path) {
+    Close();
+    Error = nullptr;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return _Fail("Cannot open the file");
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return _Fail("Empty file");
+    }
+    // The view keeps the mapping alive after the handles are closed
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* data = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (mapping != nullptr)
+        CloseHandle(mapping);
+    CloseHandle(file);
+    if (data == nullptr)
+        return _Fail("Cannot map the file");
+    _Size = (size_t)size.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return _Fail("Cannot open the file");
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return _Fail("Empty file");
+    }
+    // The mapping stays valid after the descriptor is closed
+    void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return _Fail("Cannot map the file");
+    _Size = (size_t)st.st_size;
+#endif
+    _Data = (const unsigned char*)data;
+    return true;
+}
+
+void ImPlot3DDataFile::Close() {
+    if (_Data != nullptr) {
+#ifdef _WIN32
+        UnmapViewOfFile(_Data);
+#else
+        munmap((void*)_Data, _Size);
+#endif
+    }
+    _Data = nullptr;
+    _Size = 0;
+    Columns.clear();
+}
+
+bool ImPlot3DDataFile::Open(const char* path) {
+    if (!_Map(path))
+        return false;
+
+    // ImPlot3D column file
+    if (_Size >= COLUMN_FILE_HEADER_SIZE && memcmp(_Data, COLUMN_FILE_MAGIC, sizeof(COLUMN_FILE_MAGIC)) == 0) {
+        if (ReadU32(_Data + 8) != COLUMN_FILE_VERSION)
+            return _Fail("Unsupported column file version");
+        const ImU32 column_count = ReadU32(_Data + 12);
+        const ImU64 row_count = ReadU64(_Data + 16);
+        if (column_count > (_Size - COLUMN_FILE_HEADER_SIZE) / COLUMN_HEADER_SIZE)
+            return _Fail("Truncated column file header");
+        Columns.resize((int)column_count);
+        for (int i = 0; i < (int)column_count; i++) {
+            const unsigned char* header = _Data + COLUMN_FILE_HEADER_SIZE + i * COLUMN_HEADER_SIZE;
+            ImPlot3DColumn& column = Columns[i];
+            column = ImPlot3DColumn();
+            column.Type = (ImGuiDataType)ReadU32(header);
+            column.Stride = (int)ReadU32(header + 4);
+            const ImU64 offset = ReadU64(header + 8);
+            ImStrncpy(column.Name, (const char*)header + 16, sizeof(column.Name));
+            const int type_size = DataTypeSize(column.Type);
+            if (type_size == 0 || column.Stride < type_size)
+                return _Fail("Invalid column type or stride");
+            // Written so that none of the terms can overflow, whatever the header contains
+            if (offset > _Size || (row_count > 0 && ((ImU64)type_size > _Size - offset ||
+                                                     row_count - 1 > (_Size - offset - type_size) / (ImU64)column.Stride)))
+                return _Fail("Column out of the file");
+            column.Data = _Data + offset;
+            column.Count = (ImS64)row_count;
+        }
+        return true;
+    }
+
+    // NPY file
+    if (_Size >= 10 && memcmp(_Data, NPY_MAGIC, sizeof(NPY_MAGIC)) == 0) {
+        const int major = _Data[6];
+        const size_t header_begin = major == 1 ? 10 : 12;
+        const size_t header_len = major == 1 ? (size_t)(_Data[8] | (_Data[9] << 8)) : (size_t)ReadU32(_Data + 8);
+        if (header_begin > _Size || header_len > _Size - header_begin)
+            return _Fail("Truncated NPY header");
+        const char* header = (const char*)_Data + header_begin;
+        const char* header_end = header + header_len;
+
+        // Type
+        ImGuiDataType type;
+        const char* descr = FindNpyValue(header, header_end, "'descr'");
+        if (descr == nullptr || *descr != '\'')
+            return _Fail("Unsupported NPY dtype (structured arrays are not supported)");
+        const char* descr_end = (const char*)memchr(descr + 1, '\'', header_end - descr - 1);
+        if (descr_end == nullptr || !ParseNpyDescr(descr + 1, (int)(descr_end - descr - 1), &type))
+            return _Fail("Unsupported NPY dtype");
+        const int type_size = DataTypeSize(type);
+
+        // Order
+        const char* fortran = FindNpyValue(header, header_end, "'fortran_order'");
+        const bool fortran_order = fortran != nullptr && *fortran == 'T';
+
+        // Shape: the first dimension is the number of rows, the others are flattened into columns
+        const char* shape = FindNpyValue(header, header_end, "'shape'");
+        if (shape == nullptr || *shape != '(')
+            return _Fail("Invalid NPY shape");
+        ImS64 dims[8];
+        int dim_count = 0;
+        for (const char* p = shape + 1; p < header_end && *p != ')';) {
+            if (*p >= '0' && *p <= '9') {
+                if (dim_count == IM_ARRAYSIZE(dims))
+                    return _Fail("Too many NPY dimensions");
+                char* end;
+                dims[dim_count++] = (ImS64)strtoll(p, &end, 10);
+                p = end;
+            } else {
+                p++;
+            }
+        }
+        for (int i = 0; i < dim_count; i++)
+            if (dims[i] <= 0)
+                return _Fail("Invalid NPY shape");
+        const ImS64 rows = dim_count > 0 ? dims[0] : 1;
+        ImS64 cols = 1;
+        for (int i = 1; i < dim_count; i++) {
+            if (dims[i] > 4096 || cols * dims[i] > 4096)
+                return _Fail("Too many NPY columns");
+            cols *= dims[i];
+        }
+
+        // Written so that rows * cols * type_size can't overflow
+        const size_t data_offset = header_begin + header_len;
+        if ((ImU64)rows > (_Size - data_offset) / (size_t)(cols * type_size))
+            return _Fail("Truncated NPY data");
+        Columns.resize((int)cols);
+        for (int i = 0; i < (int)cols; i++) {
+            ImPlot3DColumn& column = Columns[i];
+            column = ImPlot3DColumn();
+            column.Type = type;
+            column.Count = rows;
+            if (fortran_order) {
+                column.Data = _Data + data_offset + (size_t)(i * rows * type_size);
+                column.Stride = type_size;
+            } else {
+                column.Data = _Data + data_offset + (size_t)(i * type_size);
+                column.Stride = (int)cols * type_size;
+            }
+        }
+        return true;
+    }
+
+    return _Fail("Unknown file format");
+}
+
+bool ImPlot3DDataFile::OpenRaw(const char* path, ImGuiDataType type, int column_count, size_t header_size) {
+    const int type_size = DataTypeSize(type);
+    IM_ASSERT_USER_ERROR(type_size > 0, "Unsupported data type!");
+    IM_ASSERT_USER_ERROR(column_count > 0, "column_count must be greater than zero!");
+    if (!_Map(path))
+        return false;
+    if (header_size > _Size)
+        return _Fail("Header larger than the file");
+    const int record_size = column_count * type_size;
+    Columns.resize(column_count);
+    for (int i = 0; i < column_count; i++) {
+        ImPlot3DColumn& column = Columns[i];
+        column = ImPlot3DColumn();
+        column.Data = _Data + header_size + i * type_size;
+        column.Count = (ImS64)((_Size - header_size) / record_size);
+        column.Stride = record_size;
+        column.Type = type;
+    }
+    return true;
+}
+
+const ImPlot3DColumn* ImPlot3DDataFile::GetColumn(const char* name) const {
+    for (const ImPlot3DColumn& column : Columns)
+        if (strcmp(column.Name, name) == 0)
+            return &column;
+    return nullptr;
+}
+
+namespace ImPlot3D {
+
+//-----------------------------------------------------------------------------
+// [SECTION] SaveColumns
+//-----------------------------------------------------------------------------
+
+static void WriteU32(unsigned char* p, ImU32 v) {
+    for (int i = 0; i < 4; i++)
+        p[i] = (unsigned char)(v >> (8 * i));
+}
+
+static void WriteU64(unsigned char* p, ImU64 v) {
+    WriteU32(p, (ImU32)v);
+    WriteU32(p + 4, (ImU32)(v >> 32));
+}
+
+bool SaveColumns(const char* path, const ImPlot3DColumn* columns, int column_count) {
+    IM_ASSERT_USER_ERROR(column_count > 0, "column_count must be greater than zero!");
+    const ImS64 row_count = columns[0].Count;
+    for (int i = 1; i < column_count; i++)
+        IM_ASSERT_USER_ERROR(columns[i].Count == row_count, "All columns must have the same count!");
+
+    FILE* f = fopen(path, "wb");
+    if (f == nullptr)
+        return false;
+
+    // Headers, then each column at an aligned offset
+    const size_t headers_size = COLUMN_FILE_HEADER_SIZE + column_count * COLUMN_HEADER_SIZE;
+    ImVector<unsigned char> headers;
+    headers.resize((int)headers_size);
+    memset(headers.Data, 0, headers_size);
+    memcpy(headers.Data, COLUMN_FILE_MAGIC, sizeof(COLUMN_FILE_MAGIC));
+    WriteU32(headers.Data + 8, COLUMN_FILE_VERSION);
+    WriteU32(headers.Data + 12, (ImU32)column_count);
+    WriteU64(headers.Data + 16, (ImU64)row_count);
+    size_t offset = headers_size;
+    for (int i = 0; i < column_count; i++) {
+        const int type_size = DataTypeSize(columns[i].Type);
+        IM_ASSERT_USER_ERROR(type_size > 0, "Unsupported data type!");
+        offset = (offset + COLUMN_FILE_ALIGNMENT - 1) & ~(COLUMN_FILE_ALIGNMENT - 1);
+        unsigned char* header = headers.Data + COLUMN_FILE_HEADER_SIZE + i * COLUMN_HEADER_SIZE;
+        WriteU32(header, (ImU32)columns[i].Type);
+        WriteU32(header + 4, (ImU32)type_size);
+        WriteU64(header + 8, (ImU64)offset);
+        ImStrncpy((char*)header + 16, columns[i].Name, 32);
+        offset += (size_t)(row_count * type_size);
+    }
+    bool ok = fwrite(headers.Data, 1, headers_size, f) == headers_size;
+
+    // Copy the values in blocks, strided columns are packed on the way
+    unsigned char buffer[64 * 1024];
+    size_t written = headers_size;
+    for (int i = 0; i < column_count && ok; i++) {
+        const ImPlot3DColumn& column = columns[i];
+        const int type_size = DataTypeSize(column.Type);
+        static const unsigned char padding[COLUMN_FILE_ALIGNMENT] = {};
+        const size_t pad = ((written + COLUMN_FILE_ALIGNMENT - 1) & ~(COLUMN_FILE_ALIGNMENT - 1)) - written;
+        ok = fwrite(padding, 1, pad, f) == pad;
+        written += pad;
+        const int values_per_block = (int)sizeof(buffer) / type_size;
+        for (ImS64 first = 0; first < row_count && ok; first += values_per_block) {
+            const int count = (int)ImMin((ImS64)values_per_block, row_count - first);
+            const unsigned char* src = (const unsigned char*)column.Data + first * column.Stride;
+            if (column.Stride == type_size) {
+                ok = fwrite(src, type_size, count, f) == (size_t)count;
+            } else {
+                for (int j = 0; j < count; j++)
+                    memcpy(buffer + j * type_size, src + (size_t)j * column.Stride, type_size);
+                ok = fwrite(buffer, type_size, count, f) == (size_t)count;
+            }
+            written += (size_t)count * type_size;
+        }
+    }
+    return fclose(f) == 0 && ok;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Mesh Loaders
+//-----------------------------------------------------------------------------
+
+static bool MeshFail(ImPlot3DMeshData* mesh, const char* error) {
+    mesh->Clear();
+    mesh->Error = error;
+    return false;
+}
+
+// Appends the triangles of a polygon, as a fan around its first vertex
+static void AddPolygon(ImPlot3DVector<unsigned int>& indices, const ImPlot3DVector<unsigned int>& polygon) {
+    for (int i = 1; i + 1 < polygon.Size; i++) {
+        indices.push_back(polygon[0]);
+        indices.push_back(polygon[i]);
+        indices.push_back(polygon[i + 1]);
+    }
+}
+
+// Runs the jobs on the parallel for of the current context if requested, else on the calling thread. The context parallel for is not
+// used by default: the loading thread may not be the one rendering the context, which would race with it
+static void RunMeshJobs(int count, ImPlot3DJob job, void* job_data, ImPlot3DLoadMeshFlags flags) {
+    if (ImHasFlag(flags, ImPlot3DLoadMeshFlags_Parallel)) {
+        ParallelFor(count, job, job_data);
+        return;
+    }
+    for (int i = 0; i < count; i++)
+        job(i, job_data);
+}
+
+bool LoadMesh(const char* path, ImPlot3DMeshData* mesh, ImPlot3DLoadMeshFlags flags) {
+    const char* ext = strrchr(path, '.');
+    if (ext != nullptr && ImStricmp(ext, ".stl") == 0)
+        return LoadMeshSTL(path, mesh, flags);
+    if (ext != nullptr && ImStricmp(ext, ".ply") == 0)
+        return LoadMeshPLY(path, mesh, flags);
+    if (ext != nullptr && ImStricmp(ext, ".obj") == 0)
+        return LoadMeshOBJ(path, mesh, flags);
+    return MeshFail(mesh, "Unknown mesh file extension");
+}
+
+int WeldMeshVertices(ImPlot3DMeshData* mesh, float tolerance) {
+    ImPlot3DVector<unsigned int> remap;
+    remap.resize(mesh->Vertices.Size);
+    const int unique_count = CalcWeldRemap(mesh->Vertices.Data, mesh->Vertices.Size, tolerance, remap.Data);
+    const int removed = mesh->Vertices.Size - unique_count;
+    if (removed == 0)
+        return 0;
+
+    // Unique vertices are numbered in the order of their first occurrence, so they can be compacted in place
+    int next_unique = 0;
+    for (int i = 0; i < mesh->Vertices.Size; i++)
+        if (remap[i] == (unsigned int)next_unique)
+            mesh->Vertices[next_unique++] = mesh->Vertices[i];
+    mesh->Vertices.resize(unique_count);
+
+    // Remap the indices and drop the triangles that collapsed
+    int index_count = 0;
+    for (int i = 0; i + 2 < mesh->Indices.Size; i += 3) {
+        const unsigned int a = remap[mesh->Indices[i]];
+        const unsigned int b = remap[mesh->Indices[i + 1]];
+        const unsigned int c = remap[mesh->Indices[i + 2]];
+        if (a == b || b == c || a == c)
+            continue;
+        mesh->Indices[index_count++] = a;
+        mesh->Indices[index_count++] = b;
+        mesh->Indices[index_count++] = c;
+    }
+    mesh->Indices.resize(index_count);
+    return removed;
+}
+
+// STL: binary files have an 80 bytes header, a triangle count and 50 bytes per triangle (normal, three vertices, attribute). ASCII files
+// start with "solid", but so do some binary files, so the file size decides
+bool LoadMeshSTL(const char* path, ImPlot3DMeshData* mesh, ImPlot3DLoadMeshFlags flags) {
+    mesh->Clear();
+    ImPlot3DDataFile file;
+    if (!file._Map(path))
+        return MeshFail(mesh, file.Error);
+    const unsigned char* data = file._Data;
+    const size_t size = file._Size;
+
+    if (size >= 84 && 84 + (ImU64)ReadU32(data + 80) * 50 == size) {
+        const ImU32 tri_count = ReadU32(data + 80);
+        if (tri_count > (ImU32)(INT_MAX / 3))
+            return MeshFail(mesh, "Too many triangles");
+        // Vertices are little-endian floats, copied as is
+        mesh->Vertices.resize((int)tri_count * 3);
+        for (ImU32 i = 0; i < tri_count; i++)
+            memcpy(&mesh->Vertices[(int)i * 3], data + 84 + (size_t)i * 50 + 12, 3 * sizeof(ImPlot3DPoint));
+    } else if (size >= 5 && memcmp(data, "solid", 5) == 0) {
+        const char* end = (const char*)data + size;
+        for (const char* p = (const char*)data; p < end; p = SkipLine(p, end)) {
+            p = SkipSpaces(p, end);
+            if (end - p < 6 || memcmp(p, "vertex", 6) != 0)
+                continue;
+            p += 6;
+            double v[3];
+            for (int k = 0; k < 3; k++)
+                if ((p = ParseNumber(p, end, &v[k])) == nullptr)
+                    return MeshFail(mesh, "Invalid STL vertex");
+            mesh->Vertices.push_back(ImPlot3DPoint((float)v[0], (float)v[1], (float)v[2]));
+        }
+        if (mesh->Vertices.Size % 3 != 0)
+            return MeshFail(mesh, "Invalid STL facet");
+    } else {
+        return MeshFail(mesh, "Invalid STL file");
+    }
+
+    // Each triangle has its own vertices
+    mesh->Indices.resize(mesh->Vertices.Size);
+    for (int i = 0; i < mesh->Indices.Size; i++)
+        mesh->Indices[i] = (unsigned int)i;
+    if (!ImHasFlag(flags, ImPlot3DLoadMeshFlags_NoWeld))
+        WeldMeshVertices(mesh, 0.0f);
+    return true;
+}
+
+enum PlyFormat_ {
+    PlyFormat_Ascii,
+    PlyFormat_BinaryLittleEndian,
+    PlyFormat_BinaryBigEndian,
+};
+
+struct PlyProperty {
+    ImGuiDataType Type;      // Type of the value, or of the list values
+    ImGuiDataType CountType; // Type of the list count (-1 if the property is not a list)
+    char Name[32];
+};
+
+struct PlyElement {
+    char Name[32];
+    ImS64 Count;
+    int FirstProperty; // Properties are stored in a single array
+    int PropertyCount;
+};
+
+struct PlyReader {
+    const char* P;
+    const char* End;
+    int Format;
+
+    bool Read(ImGuiDataType type, double* out) {
+        if (Format == PlyFormat_Ascii) {
+            while (P < End && (IsSpace(*P) || *P == '\n'))
+                P++;
+            const char* p = ParseNumber(P, End, out);
+            if (p == nullptr)
+                return false;
+            P = p;
+            return true;
+        }
+        const int size = DataTypeSize(type);
+        if (End - P < size)
+            return false;
+        unsigned char bytes[8];
+        for (int i = 0; i < size; i++)
+            bytes[i] = (unsigned char)P[Format == PlyFormat_BinaryBigEndian ? size - 1 - i : i];
+        P += size;
+        switch (type) {
+            case ImGuiDataType_S8: *out = (double)(ImS8)bytes[0]; break;
+            case ImGuiDataType_U8: *out = (double)bytes[0]; break;
+            case ImGuiDataType_S16: *out = (double)(ImS16)(bytes[0] | (bytes[1] << 8)); break;
+            case ImGuiDataType_U16: *out = (double)(ImU16)(bytes[0] | (bytes[1] << 8)); break;
+            case ImGuiDataType_S32: *out = (double)(ImS32)ReadU32(bytes); break;
+            case ImGuiDataType_U32: *out = (double)ReadU32(bytes); break;
+            case ImGuiDataType_Float: {
+                const ImU32 bits = ReadU32(bytes);
+                float v;
+                memcpy(&v, &bits, sizeof(v));
+                *out = v;
+                break;
+            }
+            case ImGuiDataType_Double: {
+                const ImU64 bits = ReadU64(bytes);
+                memcpy(out, &bits, sizeof(*out));
+                break;
+            }
+            default: return false;
+        }
+        return true;
+    }
+};
+
+static bool ParsePlyType(const char* token, const char* token_end, ImGuiDataType* type) {
+    static const struct {
+        const char* Name;
+        ImGuiDataType Type;
+    } types[] = {
+        {"char", ImGuiDataType_S8},     {"int8", ImGuiDataType_S8},       {"uchar", ImGuiDataType_U8},      {"uint8", ImGuiDataType_U8},
+        {"short", ImGuiDataType_S16},   {"int16", ImGuiDataType_S16},     {"ushort", ImGuiDataType_U16},    {"uint16", ImGuiDataType_U16},
+        {"int", ImGuiDataType_S32},     {"int32", ImGuiDataType_S32},     {"uint", ImGuiDataType_U32},      {"uint32", ImGuiDataType_U32},
+        {"float", ImGuiDataType_Float}, {"float32", ImGuiDataType_Float}, {"double", ImGuiDataType_Double}, {"float64", ImGuiDataType_Double},
+    };
+    for (int i = 0; i < IM_ARRAYSIZE(types); i++) {
+        if (TokenEquals(token, token_end, types[i].Name)) {
+            *type = types[i].Type;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool LoadMeshPLY(const char* path, ImPlot3DMeshData* mesh, ImPlot3DLoadMeshFlags flags) {
+    mesh->Clear();
+    ImPlot3DDataFile file;
+    if (!file._Map(path))
+        return MeshFail(mesh, file.Error);
+    const char* p = (const char*)file._Data;
+    const char* end = p + file._Size;
+    if (end - p < 4 || memcmp(p, "ply", 3) != 0)
+        return MeshFail(mesh, "Invalid PLY file");
+
+    // Header
+    int format = -1;
+    ImPlot3DVector<PlyElement> elements;
+    ImPlot3DVector<PlyProperty> properties;
+    for (p = SkipLine(p, end);; p = SkipLine(p, end)) {
+        if (p == end)
+            return MeshFail(mesh, "Truncated PLY header");
+        const char* line_end = SkipLine(p, end);
+        const char* token_end;
+        const char* token = NextToken(p, line_end, &token_end);
+        if (TokenEquals(token, token_end, "end_header")) {
+            p = line_end;
+            break;
+        }
+        if (TokenEquals(token, token_end, "format")) {
+            token = NextToken(token_end, line_end, &token_end);
+            if (TokenEquals(token, token_end, "ascii"))
+                format = PlyFormat_Ascii;
+            else if (TokenEquals(token, token_end, "binary_little_endian"))
+                format = PlyFormat_BinaryLittleEndian;
+            else if (TokenEquals(token, token_end, "binary_big_endian"))
+                format = PlyFormat_BinaryBigEndian;
+            else
+                return MeshFail(mesh, "Unknown PLY format");
+        } else if (TokenEquals(token, token_end, "element")) {
+            PlyElement element;
+            token = NextToken(token_end, line_end, &token_end);
+            CopyToken(element.Name, IM_ARRAYSIZE(element.Name), token, token_end);
+            if (ParseInt(token_end, line_end, &element.Count) == nullptr || element.Count < 0)
+                return MeshFail(mesh, "Invalid PLY element count");
+            element.FirstProperty = properties.Size;
+            element.PropertyCount = 0;
+            elements.push_back(element);
+        } else if (TokenEquals(token, token_end, "property")) {
+            if (elements.empty())
+                return MeshFail(mesh, "PLY property without element");
+            PlyProperty property;
+            property.CountType = -1;
+            token = NextToken(token_end, line_end, &token_end);
+            if (TokenEquals(token, token_end, "list")) {
+                token = NextToken(token_end, line_end, &token_end);
+                if (!ParsePlyType(token, token_end, &property.CountType))
+                    return MeshFail(mesh, "Unsupported PLY property type");
+                token = NextToken(token_end, line_end, &token_end);
+            }
+            if (!ParsePlyType(token, token_end, &property.Type))
+                return MeshFail(mesh, "Unsupported PLY property type");
+            token = NextToken(token_end, line_end, &token_end);
+            CopyToken(property.Name, IM_ARRAYSIZE(property.Name), token, token_end);
+            properties.push_back(property);
+            elements.back().PropertyCount++;
+        }
+    }
+    if (format == -1)
+        return MeshFail(mesh, "Missing PLY format");
+
+    // Elements, read in the order of the header
+    PlyReader reader;
+    reader.P = p;
+    reader.End = end;
+    reader.Format = format;
+    ImPlot3DVector<unsigned int> polygon;
+    for (const PlyElement& element : elements) {
+        const PlyProperty* props = properties.Data + element.FirstProperty;
+        const bool is_vertex = strcmp(element.Name, "vertex") == 0;
+        const bool is_face = strcmp(element.Name, "face") == 0;
+        int xyz[3] = {-1, -1, -1};
+        int indices_prop = -1;
+        bool has_lists = false;
+        for (int j = 0; j < element.PropertyCount; j++) {
+            const PlyProperty& prop = props[j];
+            has_lists |= prop.CountType != -1;
+            if (is_vertex && prop.CountType == -1 && prop.Name[0] >= 'x' && prop.Name[0] <= 'z' && prop.Name[1] == '\0')
+                xyz[prop.Name[0] - 'x'] = j;
+            if (is_face && prop.CountType != -1 && (strcmp(prop.Name, "vertex_indices") == 0 || strcmp(prop.Name, "vertex_index") == 0))
+                indices_prop = j;
+        }
+        if (is_vertex) {
+            if (xyz[0] == -1 || xyz[1] == -1 || xyz[2] == -1)
+                return MeshFail(mesh, "PLY vertices without x, y and z");
+            if (element.Count > INT_MAX)
+                return MeshFail(mesh, "Too many vertices");
+            mesh->Vertices.resize((int)element.Count);
+        }
+        if (is_face && indices_prop == -1)
+            return MeshFail(mesh, "PLY faces without vertex indices");
+
+        // Fast path for little-endian float vertices, which have a fixed size
+        if (is_vertex && format == PlyFormat_BinaryLittleEndian && !has_lists && props[xyz[0]].Type == ImGuiDataType_Float &&
+            props[xyz[1]].Type == ImGuiDataType_Float && props[xyz[2]].Type == ImGuiDataType_Float) {
+            int offsets[3] = {0, 0, 0};
+            int vertex_size = 0;
+            for (int j = 0; j < element.PropertyCount; j++) {
+                for (int k = 0; k < 3; k++)
+                    if (j == xyz[k])
+                        offsets[k] = vertex_size;
+                vertex_size += DataTypeSize(props[j].Type);
+            }
+            if ((ImU64)(end - reader.P) < (ImU64)element.Count * vertex_size)
+                return MeshFail(mesh, "Truncated PLY data");
+            for (int i = 0; i < mesh->Vertices.Size; i++, reader.P += vertex_size)
+                for (int k = 0; k < 3; k++)
+                    memcpy(&mesh->Vertices[i][k], reader.P + offsets[k], sizeof(float));
+            continue;
+        }
+
+        for (ImS64 i = 0; i < element.Count; i++) {
+            for (int j = 0; j < element.PropertyCount; j++) {
+                const PlyProperty& prop = props[j];
+                double value;
+                if (prop.CountType == -1) {
+                    if (!reader.Read(prop.Type, &value))
+                        return MeshFail(mesh, "Truncated PLY data");
+                    for (int k = 0; k < 3; k++)
+                        if (j == xyz[k])
+                            mesh->Vertices[(int)i][k] = (float)value;
+                    continue;
+                }
+                double count;
+                if (!reader.Read(prop.CountType, &count) || count < 0.0)
+                    return MeshFail(mesh, "Truncated PLY data");
+                polygon.resize(0);
+                for (int k = 0; k < (int)count; k++) {
+                    if (!reader.Read(prop.Type, &value))
+                        return MeshFail(mesh, "Truncated PLY data");
+                    if (j != indices_prop)
+                        continue;
+                    if (value < 0.0 || value >= (double)mesh->Vertices.Size)
+                        return MeshFail(mesh, "PLY face index out of range");
+                    polygon.push_back((unsigned int)value);
+                }
+                AddPolygon(mesh->Indices, polygon);
+            }
+        }
+    }
+    if (!ImHasFlag(flags, ImPlot3DLoadMeshFlags_NoWeld))
+        WeldMeshVertices(mesh, 0.0f);
+    return true;
+}
+
+// OBJ files are split in chunks of whole lines parsed by parallel jobs. A first pass counts the vertices of each chunk, so that the second
+// pass can write the vertices in place and resolve the relative (negative) face indices
+struct ObjChunk {
+    const char* Begin;
+    const char* End;
+    int VertexCount;                // Vertices in the chunk
+    int VertexOffset;               // Vertices in the previous chunks
+    ImPlot3DVector<unsigned int> Indices; // Triangles of the chunk
+    ImPlot3DVector<unsigned int> Polygon; // Face being parsed
+    const char* Error;
+
+    ObjChunk() {
+        Begin = End = nullptr;
+        VertexCount = VertexOffset = 0;
+        Error = nullptr;
+    }
+};
+
+struct ObjJobData {
+    ObjChunk* Chunks;
+    ImPlot3DPoint* Vertices;
+    int VertexCount;
+};
+
+static inline bool IsObjCommand(const char* p, const char* end, char command) { return end - p >= 2 && p[0] == command && IsSpace(p[1]); }
+
+static void CountObjVerticesJob(int index, void* job_data) {
+    ObjChunk& chunk = ((ObjJobData*)job_data)->Chunks[index];
+    for (const char* p = chunk.Begin; p < chunk.End; p = SkipLine(p, chunk.End))
+        if (IsObjCommand(SkipSpaces(p, chunk.End), chunk.End, 'v'))
+            chunk.VertexCount++;
+}
+
+static void ParseObjJob(int index, void* job_data) {
+    ObjJobData& data = *(ObjJobData*)job_data;
+    ObjChunk& chunk = data.Chunks[index];
+    const char* end = chunk.End;
+    ImPlot3DPoint* vtx = data.Vertices + chunk.VertexOffset;
+    int vtx_count = chunk.VertexOffset; // Vertices defined so far, to resolve relative indices
+    for (const char* p = chunk.Begin; p < end; p = SkipLine(p, end)) {
+        p = SkipSpaces(p, end);
+        if (IsObjCommand(p, end, 'v')) {
+            double v[3];
+            p += 2;
+            for (int k = 0; k < 3; k++) {
+                if ((p = ParseNumber(p, end, &v[k])) == nullptr) {
+                    chunk.Error = "Invalid OBJ vertex";
+                    return;
+                }
+            }
+            *vtx++ = ImPlot3DPoint((float)v[0], (float)v[1], (float)v[2]);
+            vtx_count++;
+        } else if (IsObjCommand(p, end, 'f')) {
+            chunk.Polygon.resize(0);
+            for (p += 2;;) {
+                p = SkipSpaces(p, end);
+                if (p == end || *p == '\n' || *p == '#')
+                    break;
+                ImS64 i;
+                const char* q = ParseInt(p, end, &i);
+                if (q == nullptr || i == 0) {
+                    chunk.Error = "Invalid OBJ face";
+                    return;
+                }
+                i = i > 0 ? i - 1 : vtx_count + i;
+                if (i < 0 || i >= data.VertexCount) {
+                    chunk.Error = "OBJ face index out of range";
+                    return;
+                }
+                chunk.Polygon.push_back((unsigned int)i);
+                // Skip the texture coordinate and normal indices (v/vt/vn)
+                for (p = q; p < end && !IsSpace(*p) && *p != '\n';)
+                    p++;
+            }
+            AddPolygon(chunk.Indices, chunk.Polygon);
+        }
+    }
+}
+
+bool LoadMeshOBJ(const char* path, ImPlot3DMeshData* mesh, ImPlot3DLoadMeshFlags flags) {
+    mesh->Clear();
+    ImPlot3DDataFile file;
+    if (!file._Map(path))
+        return MeshFail(mesh, file.Error);
+    const char* begin = (const char*)file._Data;
+    const char* end = begin + file._Size;
+
+    // Chunks of at least 1 MB, split after a line break
+    const int job_count = ImHasFlag(flags, ImPlot3DLoadMeshFlags_Parallel) ? GetParallelJobCount() : 1;
+    const int chunk_count = (int)ImClamp((ImS64)(file._Size >> 20), (ImS64)1, (ImS64)job_count);
+    ObjChunk chunks[IMPLOT3D_MAX_JOBS];
+    const char* p = begin;
+    for (int i = 0; i < chunk_count; i++) {
+        chunks[i].Begin = p;
+        if (i == chunk_count - 1)
+            p = end;
+        else if (p < begin + file._Size / chunk_count * (i + 1))
+            p = SkipLine(begin + file._Size / chunk_count * (i + 1), end);
+        chunks[i].End = p;
+    }
+
+    ObjJobData data;
+    data.Chunks = chunks;
+    data.Vertices = nullptr;
+    data.VertexCount = 0;
+    RunMeshJobs(chunk_count, CountObjVerticesJob, &data, flags);
+    ImS64 vertex_count = 0;
+    for (int i = 0; i < chunk_count; i++) {
+        chunks[i].VertexOffset = (int)vertex_count;
+        vertex_count += chunks[i].VertexCount;
+        if (vertex_count > INT_MAX)
+            return MeshFail(mesh, "Too many vertices");
+    }
+    mesh->Vertices.resize((int)vertex_count);
+    data.Vertices = mesh->Vertices.Data;
+    data.VertexCount = (int)vertex_count;
+    RunMeshJobs(chunk_count, ParseObjJob, &data, flags);
+
+    ImS64 index_count = 0;
+    for (int i = 0; i < chunk_count; i++) {
+        if (chunks[i].Error != nullptr)
+            return MeshFail(mesh, chunks[i].Error);
+        index_count += chunks[i].Indices.Size;
+    }
+    if (index_count > INT_MAX)
+        return MeshFail(mesh, "Too many triangles");
+    mesh->Indices.resize((int)index_count);
+    unsigned int* idx = mesh->Indices.Data;
+    for (int i = 0; i < chunk_count; i++) {
+        memcpy(idx, chunks[i].Indices.Data, chunks[i].Indices.Size * sizeof(unsigned int));
+        idx += chunks[i].Indices.Size;
+    }
+    if (!ImHasFlag(flags, ImPlot3DLoadMeshFlags_NoWeld))
+        WeldMeshVertices(mesh, 0.0f);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Plot Items
+//-----------------------------------------------------------------------------
+
+// Returns the number of points of three columns plotted together
+static int GetColumnsCount(const ImPlot3DColumn& xs, const ImPlot3DColumn& ys, const ImPlot3DColumn& zs) {
+    IM_ASSERT_USER_ERROR(xs.Type == ys.Type && xs.Type == zs.Type, "The columns must have the same type!");
+    IM_ASSERT_USER_ERROR(xs.Stride == ys.Stride && xs.Stride == zs.Stride, "The columns must have the same stride!");
+    const ImS64 count = ImMin(xs.Count, ImMin(ys.Count, zs.Count));
+    IM_ASSERT_USER_ERROR(count <= INT_MAX, "Too many points for a single item, plot slices of the columns instead!");
+    return (int)count;
+}
+
+#define IMPLOT3D_COLUMN_DISPATCH(type, CALL)                                                                                                       \
+    switch (type) {                                                                                                                                \
+        case ImGuiDataType_S8: CALL(ImS8); break;                                                                                                  \
+        case ImGuiDataType_U8: CALL(ImU8); break;                                                                                                  \
+        case ImGuiDataType_S16: CALL(ImS16); break;                                                                                                \
+        case ImGuiDataType_U16: CALL(ImU16); break;                                                                                                \
+        case ImGuiDataType_S32: CALL(ImS32); break;                                                                                                \
+        case ImGuiDataType_U32: CALL(ImU32); break;                                                                                                \
+        case ImGuiDataType_S64: CALL(ImS64); break;                                                                                                \
+        case ImGuiDataType_U64: CALL(ImU64); break;                                                                                                \
+        case ImGuiDataType_Float: CALL(float); break;                                                                                              \
+        case ImGuiDataType_Double: CALL(double); break;                                                                                            \
+        default: IM_ASSERT_USER_ERROR(false, "Unsupported data type!"); break;                                                                     \
+    }
+
+void PlotScatter(const char* label_id, const ImPlot3DColumn& xs, const ImPlot3DColumn& ys, const ImPlot3DColumn& zs, ImPlot3DScatterFlags flags) {
+    const int count = GetColumnsCount(xs, ys, zs);
+#define CALL(T) PlotScatter(label_id, (const T*)xs.Data, (const T*)ys.Data, (const T*)zs.Data, count, flags, 0, xs.Stride)
+    IMPLOT3D_COLUMN_DISPATCH(xs.Type, CALL)
+#undef CALL
+}
+
+void PlotLine(const char* label_id, const ImPlot3DColumn& xs, const ImPlot3DColumn& ys, const ImPlot3DColumn& zs, ImPlot3DLineFlags flags) {
+    const int count = GetColumnsCount(xs, ys, zs);
+#define CALL(T) PlotLine(label_id, (const T*)xs.Data, (const T*)ys.Data, (const T*)zs.Data, count, flags, 0, xs.Stride)
+    IMPLOT3D_COLUMN_DISPATCH(xs.Type, CALL)
+#undef CALL
+}
+
+void PlotSurface(const char* label_id, const ImPlot3DColumn& xs, const ImPlot3DColumn& ys, const ImPlot3DColumn& zs, int x_count, int y_count,
+                 double scale_min, double scale_max, ImPlot3DSurfaceFlags flags) {
+    const int count = GetColumnsCount(xs, ys, zs);
+    IM_ASSERT_USER_ERROR((ImS64)x_count * y_count <= count, "The columns are smaller than x_count * y_count!");
+    IM_UNUSED(count);
+#define CALL(T)                                                                                                                                    \
+    PlotSurface(label_id, (const T*)xs.Data, (const T*)ys.Data, (const T*)zs.Data, x_count, y_count, scale_min, scale_max, flags, 0, xs.Stride)
+    IMPLOT3D_COLUMN_DISPATCH(xs.Type, CALL)
+#undef CALL
+}
+
+#undef IMPLOT3D_COLUMN_DISPATCH
+
+void PlotMesh(const char* label_id, const ImPlot3DMeshData& mesh, ImPlot3DMeshFlags flags) {
+    PlotMesh(label_id, mesh.Vertices.Data, mesh.Indices.Data, mesh.Vertices.Size, mesh.Indices.Size, flags);
+}
+
+} // namespace ImPlot3D
+
+#endif // #ifndef IMGUI_DISABLE
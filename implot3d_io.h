@@ -0,0 +1,149 @@
+//--------------------------------------------------
+// ImPlot3D v0.3 WIP
+// implot3d_io.h
+// Date: 2026-10-18
+// Author: Breno Cunha Queiroz (brenocq.com)
+//
+// Acknowledgments:
+//  ImPlot3D is heavily inspired by ImPlot
+//  (https://github.com/epezent/implot) by Evan Pezent,
+//  and follows a similar code style and structure to
+//  maintain consistency with ImPlot's API.
+//--------------------------------------------------
+
+// Optional module: add implot3d_io.cpp to your project to memory-map large data files and meshes and plot them without copying them
+
+// Table of Contents:
+// [SECTION] ImPlot3DColumn
+// [SECTION] ImPlot3DDataFile
+// [SECTION] ImPlot3DMeshData
+// [SECTION] Plot Items
+
+#pragma once
+#include "implot3d.h"
+#ifndef IMGUI_DISABLE
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DColumn
+//-----------------------------------------------------------------------------
+
+// View of a column of values in a mapped file. Values are read in place, pass Data/Stride to the plot functions or use the column
+// overloads below
+struct ImPlot3DColumn {
+    const void* Data;   // First value
+    ImS64 Count;        // Number of values
+    int Stride;         // Bytes between consecutive values
+    ImGuiDataType Type; // Type of the values (ImGuiDataType_S8 to ImGuiDataType_Double)
+    char Name[32];      // Name of the column (empty if the file has no names)
+
+    ImPlot3DColumn() {
+        Data = nullptr;
+        Count = 0;
+        Stride = 0;
+        Type = ImGuiDataType_Float;
+        Name[0] = '\0';
+    }
+
+    // Returns a view of count values starting at value first (e.g. to plot a time window of a recording)
+    IMPLOT3D_API ImPlot3DColumn Slice(ImS64 first, ImS64 count) const;
+};
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DDataFile
+//-----------------------------------------------------------------------------
+
+// Read-only memory-mapped data file. The operating system pages the data in on demand, so opening a file of several gigabytes is
+// immediate and only the parts that are plotted are read. Supported formats:
+// - NPY (.npy): 1D arrays, or 2D arrays whose columns become the file columns (C or Fortran order, little-endian numeric dtypes)
+// - ImPlot3D column files written by SaveColumns(): a small header with the type, stride and offset of each named column
+// - Raw binary records of column_count values of the same type, opened with OpenRaw()
+struct ImPlot3DDataFile {
+    ImVector<ImPlot3DColumn> Columns; // Columns of the file, valid until the file is closed
+    const char* Error;                // Reason of the last failure (nullptr if none)
+
+    IMPLOT3D_API ImPlot3DDataFile();
+    IMPLOT3D_API ~ImPlot3DDataFile();
+    ImPlot3DDataFile(const ImPlot3DDataFile&) = delete;
+    ImPlot3DDataFile& operator=(const ImPlot3DDataFile&) = delete;
+
+    // Maps a NPY or ImPlot3D column file, detected from its first bytes. Returns false and sets Error on failure
+    IMPLOT3D_API bool Open(const char* path);
+    // Maps a raw binary file of records of column_count values of the given type, after header_size bytes
+    IMPLOT3D_API bool OpenRaw(const char* path, ImGuiDataType type, int column_count, size_t header_size = 0);
+    // Unmaps the file. Columns are invalidated
+    IMPLOT3D_API void Close();
+    bool IsOpen() const { return _Data != nullptr; }
+
+    // Returns the column with the given name, or nullptr
+    IMPLOT3D_API const ImPlot3DColumn* GetColumn(const char* name) const;
+
+    // [Internal]
+    const unsigned char* _Data; // Mapped file
+    size_t _Size;               // Size of the mapped file in bytes
+    bool _Map(const char* path);
+    bool _Fail(const char* error);
+};
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DMeshData
+//-----------------------------------------------------------------------------
+
+// Flags for LoadMesh()
+enum ImPlot3DLoadMeshFlags_ {
+    ImPlot3DLoadMeshFlags_None = 0,          // Default
+    ImPlot3DLoadMeshFlags_NoWeld = 1 << 0,   // Keep the vertices as stored in the file instead of welding identical vertices
+    ImPlot3DLoadMeshFlags_Parallel = 1 << 1, // Parse OBJ files on the parallel for of the current context (only on the thread rendering it)
+};
+typedef int ImPlot3DLoadMeshFlags;
+
+// Mesh loaded from a file, ready to be plotted with PlotMesh(label_id, Vertices.Data, Indices.Data, Vertices.Size, Indices.Size). The buffers
+// don't allocate through ImGui, so meshes can be loaded on any thread (see ImPlot3DVector)
+struct ImPlot3DMeshData {
+    ImPlot3DVector<ImPlot3DPoint> Vertices; // Vertex positions
+    ImPlot3DVector<unsigned int> Indices;   // Three vertex indices per triangle (polygons are triangulated as fans)
+    const char* Error;                      // Reason of the last failure (nullptr if none)
+
+    ImPlot3DMeshData() { Error = nullptr; }
+    void Clear() {
+        Vertices.clear();
+        Indices.clear();
+        Error = nullptr;
+    }
+};
+
+namespace ImPlot3D {
+
+// Loads a mesh from a STL (binary or ASCII), PLY (binary or ASCII) or OBJ file, detected from the file extension. Files are memory-mapped
+// and parsed in place on the calling thread, so meshes can be loaded on a background thread. With ImPlot3DLoadMeshFlags_Parallel, OBJ
+// files are parsed on the parallel for of the current context instead (see SetParallelFor()). Identical vertices are welded unless
+// ImPlot3DLoadMeshFlags_NoWeld is set. Returns false and sets mesh->Error on failure
+IMPLOT3D_API bool LoadMesh(const char* path, ImPlot3DMeshData* mesh, ImPlot3DLoadMeshFlags flags = 0);
+IMPLOT3D_API bool LoadMeshSTL(const char* path, ImPlot3DMeshData* mesh, ImPlot3DLoadMeshFlags flags = 0);
+IMPLOT3D_API bool LoadMeshPLY(const char* path, ImPlot3DMeshData* mesh, ImPlot3DLoadMeshFlags flags = 0);
+IMPLOT3D_API bool LoadMeshOBJ(const char* path, ImPlot3DMeshData* mesh, ImPlot3DLoadMeshFlags flags = 0);
+
+// Merges the vertices of the mesh closer than tolerance (0: identical positions) and updates the indices. Returns the number of removed
+// vertices
+IMPLOT3D_API int WeldMeshVertices(ImPlot3DMeshData* mesh, float tolerance = 0.0f);
+
+// Writes columns to an ImPlot3D column file, which can then be mapped with ImPlot3DDataFile::Open(). Columns are stored one after the other
+// (planar), so each can be read without touching the others. Returns false if the file cannot be written
+IMPLOT3D_API bool SaveColumns(const char* path, const ImPlot3DColumn* columns, int column_count);
+
+//-----------------------------------------------------------------------------
+// [SECTION] Plot Items
+//-----------------------------------------------------------------------------
+
+// Plot items reading mapped columns in place. The three columns must have the same type and stride (e.g. columns of the same file), the
+// number of points is the smallest column count
+IMPLOT3D_API void PlotScatter(const char* label_id, const ImPlot3DColumn& xs, const ImPlot3DColumn& ys, const ImPlot3DColumn& zs,
+                              ImPlot3DScatterFlags flags = 0);
+IMPLOT3D_API void PlotLine(const char* label_id, const ImPlot3DColumn& xs, const ImPlot3DColumn& ys, const ImPlot3DColumn& zs,
+                           ImPlot3DLineFlags flags = 0);
+IMPLOT3D_API void PlotSurface(const char* label_id, const ImPlot3DColumn& xs, const ImPlot3DColumn& ys, const ImPlot3DColumn& zs, int x_count,
+                              int y_count, double scale_min = 0.0, double scale_max = 0.0, ImPlot3DSurfaceFlags flags = 0);
+IMPLOT3D_API void PlotMesh(const char* label_id, const ImPlot3DMeshData& mesh, ImPlot3DMeshFlags flags = 0);
+
+} // namespace ImPlot3D
+
+#endif // #ifndef IMGUI_DISABLE
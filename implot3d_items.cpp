@@ -17,19 +17,26 @@
 // [SECTION] Template instantiation utility
 // [SECTION] Item Utils
 // [SECTION] Draw Utils
+// [SECTION] Mesh Utils
 // [SECTION] Renderers
 // [SECTION] Indexers
 // [SECTION] Getters
 // [SECTION] RenderPrimitives
+// [SECTION] Shading
 // [SECTION] Markers
+// [SECTION] Colormap Sampling
 // [SECTION] PlotScatter
 // [SECTION] PlotLine
 // [SECTION] PlotTriangle
 // [SECTION] PlotQuad
 // [SECTION] PlotSurface
 // [SECTION] PlotMesh
+// [SECTION] PlotIsosurface
+// [SECTION] PlotVoxels
 // [SECTION] PlotImage
 // [SECTION] PlotText
+// [SECTION] SubmitCommandList
+// [SECTION] ImPlot3DCommandList
 
 //-----------------------------------------------------------------------------
 // [SECTION] Includes
@@ -231,6 +238,11 @@ bool BeginItemEx(const char* label_id, const _Getter& getter, ImPlot3DItemFlags
             for (int i = 0; i < getter.Count; i++)
                 plot.ExtendFit(getter(i));
         }
+        // Skip rendering if the item matches the last output of the plot
+        if (ReuseItemOutput(getter.Count, flags)) {
+            EndItem();
+            return false;
+        }
         return true;
     }
     return false;
@@ -245,27 +257,53 @@ void EndItem() {
 ImPlot3DItem* RegisterOrGetItem(const char* label_id, ImPlot3DItemFlags flags, bool* just_created) {
     ImPlot3DContext& gp = *GImPlot3D;
     ImPlot3DItemGroup& Items = *gp.CurrentItems;
-    ImGuiID id = Items.GetItemID(label_id);
+    const ImPlot3DItemHandle& handle = gp.NextItemData.Handle;
+    const bool use_handle = handle.ID != 0;
+    ImGuiID id = use_handle ? handle.ID : Items.GetItemID(label_id);
+    ImPlot3DItem* item = nullptr;
+    if (use_handle && handle.Index >= 0 && handle.Index < Items.GetItemCount() && Items.GetItemByIndex(handle.Index)->ID == id)
+        item = Items.GetItemByIndex(handle.Index);
     if (just_created != nullptr)
-        *just_created = Items.GetItem(id) == nullptr;
-    ImPlot3DItem* item = Items.GetOrAddItem(id);
+        *just_created = item == nullptr && Items.GetItem(id) == nullptr;
+    if (item == nullptr)
+        item = Items.GetOrAddItem(id);
 
     // Avoid re-adding the same item to the legend (the legend is reset every frame)
     if (item->SeenThisFrame)
         return item;
     item->SeenThisFrame = true;
+    item->ID = id;
+    if (ImHasFlag(flags, ImPlot3DItemFlags_NoLegend))
+        return item;
+
+    // The label is only copied when it changes (e.g. labels with "###"), items submitted through a handle keep their registered label
+    if (!use_handle && (item->NameOffset == -1 || strcmp(Items.Legend.Labels.Buf.Data + item->NameOffset, label_id) != 0))
+        Items.SetItemLabel(item, label_id);
 
     // Add item to the legend
-    int idx = Items.GetItemIndex(item);
-    item->ID = id;
-    if (!ImHasFlag(flags, ImPlot3DItemFlags_NoLegend) && ImGui::FindRenderedTextEnd(label_id, nullptr) != label_id) {
-        Items.Legend.Indices.push_back(idx);
-        item->NameOffset = Items.Legend.Labels.size();
-        Items.Legend.Labels.append(label_id, label_id + strlen(label_id) + 1);
-    }
+    if (item->NameOffset != -1 && item->NameShown)
+        Items.Legend.Indices.push_back(Items.GetItemIndex(item));
     return item;
 }
 
+ImPlot3DItemHandle GetItemHandle(const char* label_id) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentItems != nullptr, "GetItemHandle() needs to be called between BeginPlot() and EndPlot()!");
+    ImPlot3DItemGroup& Items = *gp.CurrentItems;
+    ImPlot3DItemHandle handle;
+    handle.ID = Items.GetItemID(label_id);
+    const bool just_created = Items.GetItem(handle.ID) == nullptr;
+    ImPlot3DItem* item = Items.GetOrAddItem(handle.ID);
+    if (just_created) {
+        item->ID = handle.ID;
+        item->Color = NextColormapColorU32();
+    }
+    if (item->NameOffset == -1 || strcmp(Items.Legend.Labels.Buf.Data + item->NameOffset, label_id) != 0)
+        Items.SetItemLabel(item, label_id);
+    handle.Index = Items.GetItemIndex(item);
+    return handle;
+}
+
 ImPlot3DItem* GetCurrentItem() {
     ImPlot3DContext& gp = *GImPlot3D;
     return gp.CurrentItem;
@@ -279,6 +317,54 @@ void BustItemCache() {
     }
 }
 
+bool ReuseItemOutput(int count, ImPlot3DItemFlags flags) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    ImPlot3DPlot& plot = *gp.CurrentPlot;
+    const ImPlot3DNextItemData& n = gp.NextItemData;
+
+    // Hash everything that affects the item output besides the view (the data is identified by its versions)
+    ImGuiID hash = ImHashData(&gp.CurrentItem->ID, sizeof(ImGuiID));
+    hash = ImHashData(&n.DataVersion, sizeof(ImU64), hash);
+    hash = ImHashData(&n.SourceVersion, sizeof(ImU64), hash);
+    hash = ImHashData(n.DataScale, sizeof(n.DataScale), hash);
+    hash = ImHashData(n.DataOffset, sizeof(n.DataOffset), hash);
+    hash = ImHashData(&n.TriangleBudget, sizeof(int), hash);
+    hash = ImHashData(&count, sizeof(int), hash);
+    hash = ImHashData(&flags, sizeof(ImPlot3DItemFlags), hash);
+    hash = ImHashData(n.Colors, sizeof(n.Colors), hash);
+    hash = ImHashData(&n.LineWeight, sizeof(float), hash);
+    hash = ImHashData(&n.Marker, sizeof(ImPlot3DMarker), hash);
+    hash = ImHashData(&n.MarkerSize, sizeof(float), hash);
+    hash = ImHashData(&n.MarkerWeight, sizeof(float), hash);
+    hash = ImHashData(&n.FillAlpha, sizeof(float), hash);
+    const bool is_auto[2] = {n.IsAutoFill, n.IsAutoLine};
+    hash = ImHashData(is_auto, sizeof(is_auto), hash);
+    hash = ImHashData(&gp.Style.Colormap, sizeof(ImPlot3DColormap), hash);
+
+    // Update the plot dirty state
+    plot.ItemsHash = ImHashData(&hash, sizeof(ImGuiID), plot.ItemsHash);
+    const bool versioned = n.DataVersion != 0 || n.SourceVersion != 0;
+    if (!versioned)
+        plot.HasUnversionedItems = true;
+
+    // Reuse the output if this item matches the item at the same position in the last output
+    const int item_idx = plot.ItemOutputs.Size;
+    if (plot.ReusingOutput && versioned && item_idx < plot.LastItemOutputs.Size && plot.LastItemOutputs[item_idx].Hash == hash) {
+        plot.ItemOutputs.push_back(plot.LastItemOutputs[item_idx]);
+        return true;
+    }
+
+    // Restore the items that were skipped so far and render from here on
+    if (plot.ReusingOutput)
+        plot.RestoreLastOutput(item_idx);
+    ImPlot3DItemOutput output;
+    output.Hash = hash;
+    output.VtxOffset = plot.DrawList.VtxBuffer.Size;
+    output.IdxOffset = plot.DrawList.IdxBuffer.Size;
+    plot.ItemOutputs.push_back(output);
+    return false;
+}
+
 void SetNextLineStyle(const ImVec4& col, float weight) {
     ImPlot3DContext& gp = *GImPlot3D;
     ImPlot3DNextItemData& n = gp.NextItemData;
@@ -303,12 +389,40 @@ void SetNextMarkerStyle(ImPlot3DMarker marker, float size, const ImVec4& fill, f
     n.MarkerWeight = weight;
 }
 
+void SetNextItemDataVersion(ImU64 version) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    ImPlot3DNextItemData& n = gp.NextItemData;
+    n.DataVersion = version;
+}
+
+void SetNextItemDataScale(ImAxis3D axis, double scale, double offset) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(axis >= ImAxis3D_X && axis < ImAxis3D_COUNT, "Invalid axis!");
+    ImPlot3DNextItemData& n = gp.NextItemData;
+    n.DataScale[axis] = scale;
+    n.DataOffset[axis] = offset;
+}
+
+void SetNextItemHandle(const ImPlot3DItemHandle& handle) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    ImPlot3DNextItemData& n = gp.NextItemData;
+    n.Handle = handle;
+}
+
+void SetNextMeshTriangleBudget(int max_triangles) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(max_triangles >= 0, "max_triangles must be positive or zero!");
+    ImPlot3DNextItemData& n = gp.NextItemData;
+    n.TriangleBudget = max_triangles;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Draw Utils
 //-----------------------------------------------------------------------------
 
-IMPLOT3D_INLINE void PrimLine(ImDrawList3D& draw_list_3d, const ImVec2& P1, const ImVec2& P2, float half_weight, ImU32 col, const ImVec2& tex_uv0,
-                              const ImVec2& tex_uv1, float z) {
+// Line segment with a color at each end, blended along the segment
+IMPLOT3D_INLINE void PrimLine(ImDrawList3D& draw_list_3d, const ImVec2& P1, const ImVec2& P2, float half_weight, ImU32 col1, ImU32 col2,
+                              const ImVec2& tex_uv0, const ImVec2& tex_uv1, float z) {
     float dx = P2.x - P1.x;
     float dy = P2.y - P1.y;
     IMPLOT3D_NORMALIZE2F(dx, dy);
@@ -317,19 +431,19 @@ IMPLOT3D_INLINE void PrimLine(ImDrawList3D& draw_list_3d, const ImVec2& P1, cons
     draw_list_3d._VtxWritePtr[0].pos.x = P1.x + dy;
     draw_list_3d._VtxWritePtr[0].pos.y = P1.y - dx;
     draw_list_3d._VtxWritePtr[0].uv = tex_uv0;
-    draw_list_3d._VtxWritePtr[0].col = col;
+    draw_list_3d._VtxWritePtr[0].col = col1;
     draw_list_3d._VtxWritePtr[1].pos.x = P2.x + dy;
     draw_list_3d._VtxWritePtr[1].pos.y = P2.y - dx;
     draw_list_3d._VtxWritePtr[1].uv = tex_uv0;
-    draw_list_3d._VtxWritePtr[1].col = col;
+    draw_list_3d._VtxWritePtr[1].col = col2;
     draw_list_3d._VtxWritePtr[2].pos.x = P2.x - dy;
     draw_list_3d._VtxWritePtr[2].pos.y = P2.y + dx;
     draw_list_3d._VtxWritePtr[2].uv = tex_uv1;
-    draw_list_3d._VtxWritePtr[2].col = col;
+    draw_list_3d._VtxWritePtr[2].col = col2;
     draw_list_3d._VtxWritePtr[3].pos.x = P1.x - dy;
     draw_list_3d._VtxWritePtr[3].pos.y = P1.y + dx;
     draw_list_3d._VtxWritePtr[3].uv = tex_uv1;
-    draw_list_3d._VtxWritePtr[3].col = col;
+    draw_list_3d._VtxWritePtr[3].col = col1;
     draw_list_3d._VtxWritePtr += 4;
     draw_list_3d._IdxWritePtr[0] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx);
     draw_list_3d._IdxWritePtr[1] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 1);
@@ -344,14 +458,501 @@ IMPLOT3D_INLINE void PrimLine(ImDrawList3D& draw_list_3d, const ImVec2& P1, cons
     draw_list_3d._ZWritePtr += 2;
 }
 
+IMPLOT3D_INLINE void PrimLine(ImDrawList3D& draw_list_3d, const ImVec2& P1, const ImVec2& P2, float half_weight, ImU32 col, const ImVec2& tex_uv0,
+                              const ImVec2& tex_uv1, float z) {
+    PrimLine(draw_list_3d, P1, P2, half_weight, col, col, tex_uv0, tex_uv1, z);
+}
+
+// Scales the alpha of a color
+IMPLOT3D_INLINE ImU32 ScaleColorAlpha(ImU32 col, float scale) {
+    const float alpha = (float)((col >> IM_COL32_A_SHIFT) & 0xFF) * scale;
+    return (col & ~IM_COL32_A_MASK) | ((ImU32)alpha << IM_COL32_A_SHIFT);
+}
+
+// Scales the red, green and blue channels of a color by shade / 256, keeping its alpha (see ShadeVertices())
+IMPLOT3D_INLINE ImU32 ShadeColor(ImU32 col, ImU32 shade) {
+    const ImU32 rb = ((col & 0x00FF00FF) * shade >> 8) & 0x00FF00FF;
+    const ImU32 g = ((col & 0x0000FF00) * shade >> 8) & 0x0000FF00;
+    return rb | g | (col & IM_COL32_A_MASK);
+}
+
 //-----------------------------------------------------------------------------
-// [SECTION] Renderers
+// [SECTION] Mesh Utils
 //-----------------------------------------------------------------------------
 
-float GetPointDepth(ImPlot3DPoint p) {
+static inline ImU32 HashWeldCell(ImS64 x, ImS64 y, ImS64 z) {
+    ImU64 h = (ImU64)x * 0x9E3779B97F4A7C15ull ^ (ImU64)y * 0xC2B2AE3D27D4EB4Full ^ (ImU64)z * 0x165667B19E3779F9ull;
+    return (ImU32)(h ^ (h >> 32));
+}
+
+int CalcWeldRemap(const ImPlot3DPoint* vtx, int vtx_count, float tolerance, unsigned int* remap) {
+    if (vtx_count <= 0)
+        return 0;
+
+    // Grid cells are tolerance wide, so a vertex can only weld with the unique vertices of its cell and of the neighboring cells. With a
+    // zero tolerance the cell is the position itself
+    int bucket_count = 1;
+    while (bucket_count < vtx_count && bucket_count < (1 << 30))
+        bucket_count <<= 1;
+    ImPlot3DVector<int> buckets; // First unique vertex of each bucket
+    ImPlot3DVector<int> next;    // Next unique vertex of the same bucket
+    ImPlot3DVector<int> firsts;  // First vertex of each unique vertex
+    buckets.resize(bucket_count);
+    memset(buckets.Data, 0xFF, bucket_count * sizeof(int));
+    next.reserve(vtx_count);
+    firsts.reserve(vtx_count);
+    const int range = tolerance > 0.0f ? 1 : 0;
+    const float tolerance_sqr = tolerance * tolerance;
+    for (int i = 0; i < vtx_count; i++) {
+        const ImPlot3DPoint& p = vtx[i];
+        ImS64 cell[3];
+        for (int k = 0; k < 3; k++) {
+            if (range == 0) {
+                ImU32 bits;
+                const float v = p[k] + 0.0f; // -0.0f to 0.0f
+                memcpy(&bits, &v, sizeof(bits));
+                cell[k] = bits;
+            } else {
+                cell[k] = (ImS64)ImFloor(p[k] / tolerance);
+            }
+        }
+
+        int found = -1;
+        for (int dz = -range; dz <= range && found == -1; dz++) {
+            for (int dy = -range; dy <= range && found == -1; dy++) {
+                for (int dx = -range; dx <= range && found == -1; dx++) {
+                    const int bucket = (int)(HashWeldCell(cell[0] + dx, cell[1] + dy, cell[2] + dz) & (ImU32)(bucket_count - 1));
+                    for (int u = buckets[bucket]; u != -1; u = next[u]) {
+                        const ImPlot3DPoint& q = vtx[firsts[u]];
+                        const bool weld = range == 0 ? (q.x == p.x && q.y == p.y && q.z == p.z) : (q - p).LengthSquared() <= tolerance_sqr;
+                        if (weld) {
+                            found = u;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+        if (found == -1) {
+            found = firsts.Size;
+            const int bucket = (int)(HashWeldCell(cell[0], cell[1], cell[2]) & (ImU32)(bucket_count - 1));
+            firsts.push_back(i);
+            next.push_back(buckets[bucket]);
+            buckets[bucket] = found;
+        }
+        remap[i] = (unsigned int)found;
+    }
+    return firsts.Size;
+}
+
+// Quadric of the squared distances to a set of planes, used to measure the error of moving a vertex
+struct MeshQuadric {
+    float XX, XY, XZ, XW, YY, YZ, YW, ZZ, ZW, WW;
+};
+
+static void AddPlaneQuadric(MeshQuadric& q, const ImPlot3DPoint& n, float d, float weight) {
+    q.XX += weight * n.x * n.x;
+    q.XY += weight * n.x * n.y;
+    q.XZ += weight * n.x * n.z;
+    q.XW += weight * n.x * d;
+    q.YY += weight * n.y * n.y;
+    q.YZ += weight * n.y * n.z;
+    q.YW += weight * n.y * d;
+    q.ZZ += weight * n.z * n.z;
+    q.ZW += weight * n.z * d;
+    q.WW += weight * d * d;
+}
+
+static void AddQuadric(MeshQuadric& q, const MeshQuadric& r) {
+    float* dst = &q.XX;
+    const float* src = &r.XX;
+    for (int i = 0; i < 10; i++)
+        dst[i] += src[i];
+}
+
+static float CalcQuadricError(const MeshQuadric& q, const ImPlot3DPoint& p) {
+    const float e = q.XX * p.x * p.x + 2.0f * (q.XY * p.x * p.y + q.XZ * p.x * p.z + q.XW * p.x) + q.YY * p.y * p.y +
+                    2.0f * (q.YZ * p.y * p.z + q.YW * p.y) + q.ZZ * p.z * p.z + 2.0f * q.ZW * p.z + q.WW;
+    return e > 0.0f ? e : 0.0f; // Also maps -0.0f and NaN to 0.0f, which the cost sort relies on
+}
+
+// Edge collapse moving vertex From onto vertex To
+struct MeshCollapse {
+    unsigned int From;
+    unsigned int To;
+    float Cost;
+};
+
+// Simplifies a triangle list by passes of edge collapses. Each pass computes the cost of collapsing every edge, then applies the cheapest
+// collapses whose neighborhoods don't overlap, so that every collapse can be checked against the triangles as they are
+struct MeshSimplifier {
+    ImVector<ImPlot3DPoint> Pos;      // Vertex positions, normalized to the unit box for the precision of the quadrics
+    ImVector<MeshQuadric> Quadrics;   // Planes of the triangles merged into each vertex
+    ImVector<unsigned int> Tris;      // Current triangles
+    ImVector<unsigned int> Remap;     // Vertex each vertex was collapsed onto (itself if it was kept)
+    ImVector<int> AdjOffsets;         // Offset of the triangles around each vertex in Adj
+    ImVector<int> Adj;                // Triangles around each vertex
+    ImVector<ImU8> Locked;            // Vertices whose neighborhood changed in the current pass
+    ImVector<MeshCollapse> Collapses; // Cheapest collapse of each edge
+    ImVector<MeshCollapse> Sorted;    // Collapses sorted by cost
+    ImVector<int> BucketOffsets;      // Counting sort buckets
+    int JobCount;                     // Jobs computing the collapses of the current pass
+
+    // Fills the triangles around each vertex: count them, then fill each range backwards so that the offsets end at the range starts
+    void CalcAdjacency() {
+        const int vtx_count = Pos.Size;
+        AdjOffsets.resize(vtx_count + 1);
+        memset(AdjOffsets.Data, 0, AdjOffsets.size_in_bytes());
+        for (int i = 0; i < Tris.Size; i++)
+            AdjOffsets[Tris[i]]++;
+        for (int v = 1; v <= vtx_count; v++)
+            AdjOffsets[v] += AdjOffsets[v - 1];
+        Adj.resize(Tris.Size);
+        for (int i = Tris.Size - 1; i >= 0; i--)
+            Adj[--AdjOffsets[Tris[i]]] = i / 3;
+    }
+
+    // Returns true if the edge a-b of triangle tri belongs to no other triangle (border of an open mesh)
+    bool IsBoundaryEdge(int tri, unsigned int a, unsigned int b) const {
+        for (int i = AdjOffsets[a]; i < AdjOffsets[a + 1]; i++) {
+            const unsigned int* t = &Tris[Adj[i] * 3];
+            if (Adj[i] != tri && (t[0] == b || t[1] == b || t[2] == b))
+                return false;
+        }
+        return true;
+    }
+
+    // Computes the collapse of each triangle edge in a range of triangles. Edges shared by two triangles are seen twice in opposite
+    // directions, only the one from the lowest vertex is kept and the other is marked as skipped (From == To). Boundary edges are only seen
+    // once, so they are kept in both directions
+    static void CalcCollapsesJob(int index, void* data) {
+        MeshSimplifier& s = *(MeshSimplifier*)data;
+        const int tri_count = s.Tris.Size / 3;
+        const int first = tri_count * index / s.JobCount * 3;
+        const int last = tri_count * (index + 1) / s.JobCount * 3;
+        for (int i = first; i < last; i++) {
+            const unsigned int a = s.Tris[i];
+            const unsigned int b = s.Tris[i % 3 == 2 ? i - 2 : i + 1];
+            MeshCollapse& c = s.Collapses[i];
+            if (a > b && !s.IsBoundaryEdge(i / 3, a, b)) {
+                c.From = c.To = a;
+                continue;
+            }
+            MeshQuadric q = s.Quadrics[a];
+            AddQuadric(q, s.Quadrics[b]);
+            const float cost_a = CalcQuadricError(q, s.Pos[a]);
+            const float cost_b = CalcQuadricError(q, s.Pos[b]);
+            c.From = cost_a <= cost_b ? b : a;
+            c.To = cost_a <= cost_b ? a : b;
+            c.Cost = ImMin(cost_a, cost_b);
+        }
+    }
+
+    // Returns true if moving From onto To flips one of the remaining triangles around From
+    bool Flips(const MeshCollapse& c) const {
+        for (int i = AdjOffsets[c.From]; i < AdjOffsets[c.From + 1]; i++) {
+            const unsigned int* t = &Tris[Adj[i] * 3];
+            if (t[0] == c.To || t[1] == c.To || t[2] == c.To)
+                continue;
+            ImPlot3DPoint p[3] = {Pos[t[0]], Pos[t[1]], Pos[t[2]]};
+            const ImPlot3DPoint before = (p[1] - p[0]).Cross(p[2] - p[0]);
+            for (int k = 0; k < 3; k++)
+                if (t[k] == c.From)
+                    p[k] = Pos[c.To];
+            const ImPlot3DPoint after = (p[1] - p[0]).Cross(p[2] - p[0]);
+            if (before.Dot(after) <= 0.0f)
+                return true;
+        }
+        return false;
+    }
+
+    // Runs one pass of collapses towards target_tri_count and returns the number of removed triangles
+    int Pass(int target_tri_count) {
+        const int vtx_count = Pos.Size;
+        const int tri_count = Tris.Size / 3;
+        CalcAdjacency();
+
+        // Cheapest direction of each edge, computed in parallel as it dominates the pass
+        Collapses.resize(Tris.Size);
+        JobCount = ImMin(GetParallelJobCount(), 1 + tri_count / 65536);
+        ParallelFor(JobCount, CalcCollapsesJob, this);
+
+        // Counting sort on the high bits of the costs (the bits of positive floats are ordered like their values)
+        const int bucket_bits = 12;
+        const int bucket_count = 1 << bucket_bits;
+        BucketOffsets.resize(bucket_count + 1);
+        memset(BucketOffsets.Data, 0, BucketOffsets.size_in_bytes());
+        int collapse_total = 0;
+        for (const MeshCollapse& c : Collapses) {
+            if (c.From == c.To)
+                continue;
+            ImU32 bits;
+            memcpy(&bits, &c.Cost, sizeof(bits));
+            BucketOffsets[(bits >> (31 - bucket_bits)) + 1]++;
+            collapse_total++;
+        }
+        for (int i = 1; i <= bucket_count; i++)
+            BucketOffsets[i] += BucketOffsets[i - 1];
+        Sorted.resize(collapse_total);
+        for (const MeshCollapse& c : Collapses) {
+            if (c.From == c.To)
+                continue;
+            ImU32 bits;
+            memcpy(&bits, &c.Cost, sizeof(bits));
+            Sorted[BucketOffsets[bits >> (31 - bucket_bits)]++] = c;
+        }
+
+        // Apply the cheapest collapses. A collapse locks every vertex of the triangles around From, which are the only triangles it changes.
+        // Interior collapses remove two triangles
+        Locked.resize(vtx_count);
+        memset(Locked.Data, 0, Locked.size_in_bytes());
+        const int max_collapses = (tri_count - target_tri_count + 1) / 2;
+        int collapse_count = 0;
+        for (int i = 0; i < Sorted.Size && collapse_count < max_collapses; i++) {
+            const MeshCollapse& c = Sorted[i];
+            if (Locked[c.From] || Locked[c.To] || Flips(c))
+                continue;
+            for (int j = AdjOffsets[c.From]; j < AdjOffsets[c.From + 1]; j++)
+                for (int k = 0; k < 3; k++)
+                    Locked[Tris[Adj[j] * 3 + k]] = 1;
+            Remap[c.From] = c.To;
+            AddQuadric(Quadrics[c.To], Quadrics[c.From]);
+            collapse_count++;
+        }
+
+        // Remap the triangles and drop the collapsed ones
+        int idx_count = 0;
+        for (int i = 0; i < Tris.Size; i += 3) {
+            const unsigned int a = Remap[Tris[i]];
+            const unsigned int b = Remap[Tris[i + 1]];
+            const unsigned int c = Remap[Tris[i + 2]];
+            if (a == b || b == c || a == c)
+                continue;
+            Tris[idx_count++] = a;
+            Tris[idx_count++] = b;
+            Tris[idx_count++] = c;
+        }
+        Tris.resize(idx_count);
+        return tri_count - idx_count / 3;
+    }
+};
+
+void BuildMeshLOD(ImPlot3DMeshLOD& lod, const ImPlot3DPoint* vtx, int vtx_count, const unsigned int* idx, int idx_count) {
+    lod.Indices.resize(0);
+    lod.Levels.resize(0);
+    lod.BoundsMin = ImPlot3DPoint(FLT_MAX, FLT_MAX, FLT_MAX);
+    lod.BoundsMax = ImPlot3DPoint(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (int i = 0; i < idx_count; i++) {
+        for (int k = 0; k < 3; k++) {
+            lod.BoundsMin[k] = ImMin(lod.BoundsMin[k], vtx[idx[i]][k]);
+            lod.BoundsMax[k] = ImMax(lod.BoundsMax[k], vtx[idx[i]][k]);
+        }
+    }
+    if (idx_count / 3 <= IMPLOT3D_MESH_LOD_MIN_TRIANGLES)
+        return;
+
+    MeshSimplifier s;
+    const ImPlot3DPoint extent = lod.BoundsMax - lod.BoundsMin;
+    const float scale = 1.0f / ImMax(ImMax(extent.x, extent.y), ImMax(extent.z, FLT_MIN));
+    s.Pos.resize(vtx_count);
+    s.Remap.resize(vtx_count);
+    for (int i = 0; i < vtx_count; i++) {
+        s.Pos[i] = (vtx[i] - lod.BoundsMin) * scale;
+        s.Remap[i] = (unsigned int)i;
+    }
+
+    // Each vertex starts with the planes of its triangles, weighted by their area. Zero area triangles are not rendered and are dropped
+    s.Quadrics.resize(vtx_count);
+    memset(s.Quadrics.Data, 0, s.Quadrics.size_in_bytes());
+    s.Tris.reserve(idx_count - idx_count % 3);
+    for (int i = 0; i + 2 < idx_count; i += 3) {
+        const unsigned int t[3] = {idx[i], idx[i + 1], idx[i + 2]};
+        ImPlot3DPoint n = (s.Pos[t[1]] - s.Pos[t[0]]).Cross(s.Pos[t[2]] - s.Pos[t[0]]);
+        const float length = n.Length();
+        if (!(length > 0.0f))
+            continue;
+        n /= length;
+        const float d = -n.Dot(s.Pos[t[0]]);
+        for (int k = 0; k < 3; k++) {
+            AddPlaneQuadric(s.Quadrics[t[k]], n, d, 0.5f * length);
+            s.Tris.push_back(t[k]);
+        }
+    }
+
+    // Boundary edges also add the plane through the edge perpendicular to their triangle, heavily weighted so that the borders of open
+    // meshes are kept in place instead of eroding
+    const float boundary_weight = 10.0f;
+    s.CalcAdjacency();
+    for (int i = 0; i < s.Tris.Size; i++) {
+        const unsigned int a = s.Tris[i];
+        const unsigned int b = s.Tris[i % 3 == 2 ? i - 2 : i + 1];
+        if (!s.IsBoundaryEdge(i / 3, a, b))
+            continue;
+        const unsigned int* t = &s.Tris[i / 3 * 3];
+        const ImPlot3DPoint edge = s.Pos[b] - s.Pos[a];
+        ImPlot3DPoint n = edge.Cross((s.Pos[t[1]] - s.Pos[t[0]]).Cross(s.Pos[t[2]] - s.Pos[t[0]]));
+        const float length = n.Length();
+        if (!(length > 0.0f))
+            continue;
+        n /= length;
+        const float d = -n.Dot(s.Pos[a]);
+        AddPlaneQuadric(s.Quadrics[a], n, d, boundary_weight * edge.Dot(edge));
+        AddPlaneQuadric(s.Quadrics[b], n, d, boundary_weight * edge.Dot(edge));
+    }
+
+    // Each level continues from the previous one, so the quadrics keep the error accumulated by the previous collapses. Stop when a level
+    // can no longer be reduced significantly (e.g. when every remaining collapse would flip triangles)
+    int tri_count = s.Tris.Size / 3;
+    while (tri_count > IMPLOT3D_MESH_LOD_MIN_TRIANGLES) {
+        // Levels only need to be about a quarter of the previous one, the last passes would remove very few triangles each
+        const int target_tri_count = tri_count / 4;
+        const int prev_tri_count = tri_count;
+        for (int pass = 0; pass < 32 && tri_count > target_tri_count + target_tri_count / 8; pass++) {
+            const int removed = s.Pass(target_tri_count);
+            if (removed == 0)
+                break;
+            tri_count -= removed;
+        }
+        if (tri_count > prev_tri_count / 4 * 3)
+            break;
+        ImPlot3DMeshLOD::Level level;
+        level.IdxOffset = lod.Indices.Size;
+        level.IdxCount = s.Tris.Size;
+        lod.Levels.push_back(level);
+        lod.Indices.resize(lod.Indices.Size + s.Tris.Size);
+        memcpy(lod.Indices.Data + level.IdxOffset, s.Tris.Data, s.Tris.size_in_bytes());
+    }
+}
+
+ImPlot3DMeshLOD* GetMeshLOD(const ImPlot3DPoint* vtx, int vtx_count, const unsigned int* idx, int idx_count) {
     ImPlot3DContext& gp = *GImPlot3D;
-    ImPlot3DPlot& plot = *gp.CurrentPlot;
+    const void* ptrs[2] = {vtx, idx};
+    const int counts[2] = {vtx_count, idx_count};
+    ImGuiID key = ImHashData(ptrs, sizeof(ptrs));
+    key = ImHashData(counts, sizeof(counts), key);
+    key = ImHashData(&gp.NextItemData.DataVersion, sizeof(ImU64), key);
+    ImPlot3DMeshLOD* lod = gp.MeshLODs.GetOrAddByKey(key);
+    if (lod->LastFrame == -1) {
+        lod->Key = key;
+        BuildMeshLOD(*lod, vtx, vtx_count, idx, idx_count);
+    }
+    lod->LastFrame = ImGui::GetFrameCount();
+    return lod;
+}
+
+int SelectMeshLODLevel(const ImPlot3DMeshLOD& lod, int idx_count, int triangle_budget) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    const ImPlot3DPlot& plot = *gp.CurrentPlot;
+
+    // Diagonal of the mesh bounding box in pixels. Parts outside of the plot box are clipped, but they still make the mesh finer when zooming
+    const ImPlot3DPoint size_ndc = (lod.BoundsMax - lod.BoundsMin) / (plot.RangeMax() - plot.RangeMin()) * plot.BoxScale;
+    const double size_pix = (double)size_ndc.Length() * plot.GetBoxZoom();
+    double max_tri_count = size_pix * size_pix / IMPLOT3D_MESH_LOD_PIXELS_PER_TRIANGLE;
+    if (triangle_budget > 0)
+        max_tri_count = ImMin(max_tri_count, (double)triangle_budget);
+
+    // Finest level under the limit, or the coarsest level
+    if (idx_count / 3 <= max_tri_count)
+        return -1;
+    for (int i = 0; i < lod.Levels.Size; i++)
+        if (lod.Levels[i].IdxCount / 3 <= max_tri_count)
+            return i;
+    return lod.Levels.Size - 1;
+}
+
+void GarbageCollectMeshLODs() {
+    ImPlot3DContext& gp = *GImPlot3D;
+    const int frame = ImGui::GetFrameCount();
+    for (int i = 0; i < gp.MeshLODs.GetMapSize(); i++) {
+        ImPlot3DMeshLOD* lod = gp.MeshLODs.TryGetMapData(i);
+        if (lod != nullptr && frame - lod->LastFrame > IMPLOT3D_MESH_LOD_KEEP_FRAMES)
+            gp.MeshLODs.Remove(lod->Key, lod);
+    }
+}
+
+// Index of the vertex ending the triangle edge starting at index i
+static inline int NextTriangleIndex(int i) { return i % 3 == 2 ? i - 2 : i + 1; }
+
+void BuildMeshTopology(ImPlot3DMesh& mesh) {
+    const unsigned int* idx = mesh.Indices.Data;
+    const int idx_count = mesh.Indices.Size;
+    const int vtx_count = mesh.Vertices.Size;
+
+    // Group the triangle edges by their lowest vertex, so the two sides of an edge land in the same small group
+    ImVector<int> offsets;
+    offsets.resize(vtx_count + 1);
+    memset(offsets.Data, 0, offsets.size_in_bytes());
+    for (int i = 0; i < idx_count; i++)
+        offsets[ImMin(idx[i], idx[NextTriangleIndex(i)]) + 1]++;
+    for (int v = 0; v < vtx_count; v++)
+        offsets[v + 1] += offsets[v];
+    ImVector<int> cursors = offsets;
+    ImVector<int> sides;
+    sides.resize(idx_count);
+    for (int i = 0; i < idx_count; i++)
+        sides[cursors[ImMin(idx[i], idx[NextTriangleIndex(i)])]++] = i;
+
+    // Emit each edge once and pair its sides. Edges shared by more than two triangles are paired in order
+    mesh.Edges.resize(0);
+    mesh.Adjacency.resize(idx_count);
+    memset(mesh.Adjacency.Data, 0xFF, mesh.Adjacency.size_in_bytes());
+    for (int v = 0; v < vtx_count; v++) {
+        for (int e = offsets[v]; e < offsets[v + 1]; e++) {
+            const int side = sides[e];
+            const unsigned int end = ImMax(idx[side], idx[NextTriangleIndex(side)]);
+            if (end == (unsigned int)v)
+                continue; // Degenerate edge
+            bool first = true;
+            for (int f = offsets[v]; f < e && first; f++)
+                first = ImMax(idx[sides[f]], idx[NextTriangleIndex(sides[f])]) != end;
+            if (first) {
+                mesh.Edges.push_back((unsigned int)v);
+                mesh.Edges.push_back(end);
+            }
+            if (mesh.Adjacency[side] != -1)
+                continue;
+            for (int f = e + 1; f < offsets[v + 1]; f++) {
+                const int other = sides[f];
+                if (mesh.Adjacency[other] == -1 && ImMax(idx[other], idx[NextTriangleIndex(other)]) == end) {
+                    mesh.Adjacency[side] = other / 3;
+                    mesh.Adjacency[other] = side / 3;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+ImPlot3DMesh* GetMesh(ImPlot3DMeshHandle handle) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    return handle.ID != 0 ? gp.Meshes.GetByKey(handle.ID) : nullptr;
+}
+
+void GarbageCollectIsosurfaces() {
+    ImPlot3DContext& gp = *GImPlot3D;
+    const int frame = ImGui::GetFrameCount();
+    for (int i = 0; i < gp.Isosurfaces.GetMapSize(); i++) {
+        ImPlot3DIsosurface* iso = gp.Isosurfaces.TryGetMapData(i);
+        if (iso != nullptr && frame - iso->LastFrame > IMPLOT3D_ISOSURFACE_KEEP_FRAMES)
+            gp.Isosurfaces.Remove(iso->Key, iso);
+    }
+}
+
+void GarbageCollectVoxels() {
+    ImPlot3DContext& gp = *GImPlot3D;
+    const int frame = ImGui::GetFrameCount();
+    for (int i = 0; i < gp.Voxels.GetMapSize(); i++) {
+        ImPlot3DVoxels* voxels = gp.Voxels.TryGetMapData(i);
+        if (voxels != nullptr && frame - voxels->LastFrame > IMPLOT3D_VOXELS_KEEP_FRAMES)
+            gp.Voxels.Remove(voxels->Key, voxels);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Renderers
+//-----------------------------------------------------------------------------
 
+float GetPointDepth(const ImPlot3DPlot& plot, ImPlot3DPoint p) {
     // Adjust for inverted axes before rotation
     if (ImHasFlag(plot.Axes[0].Flags, ImPlot3DAxisFlags_Invert))
         p.x = -p.x;
@@ -364,11 +965,25 @@ float GetPointDepth(ImPlot3DPoint p) {
     return p_rot.z;
 }
 
+// Color of a point: the item color, unless the getter has per-point colors (see GetterColored)
+template <typename _Getter> IMPLOT3D_INLINE ImU32 GetPointColor(const _Getter& getter, int idx, ImU32 col) {
+    IM_UNUSED(getter);
+    IM_UNUSED(idx);
+    return col;
+}
+
 struct RendererBase {
-    RendererBase(int prims, int idx_consumed, int vtx_consumed) : Prims(prims), IdxConsumed(idx_consumed), VtxConsumed(vtx_consumed) {}
+    RendererBase(int prims, int idx_consumed, int vtx_consumed)
+        : Prims(prims), IdxConsumed(idx_consumed), VtxConsumed(vtx_consumed), Plot(*GetCurrentPlot()) {}
     const unsigned int Prims;       // Number of primitives to render
     const unsigned int IdxConsumed; // Number of indices consumed per primitive
     const unsigned int VtxConsumed; // Number of vertices consumed per primitive
+    const ImPlot3DPlot& Plot;       // Plot being rendered, so primitives don't need to read the current context
+
+    // True if chunks of primitives can be rendered by different threads
+    static constexpr bool Parallel = true;
+    // Prepares a copy of the renderer to start rendering at prim (for renderers that carry state from one primitive to the next)
+    void Seek(int prim) const { IM_UNUSED(prim); }
 };
 
 template <class _Getter> struct RendererMarkersFill : RendererBase {
@@ -381,13 +996,14 @@ template <class _Getter> struct RendererMarkersFill : RendererBase {
         ImPlot3DPoint p_plot = Getter(prim);
         if (!cull_box.Contains(p_plot))
             return false;
-        ImVec2 p = PlotToPixels(p_plot);
+        ImVec2 p = PlotToPixels(Plot, p_plot);
+        const ImU32 col = GetPointColor(Getter, prim, Col);
         // 3 vertices per triangle
         for (int i = 0; i < Count; i++) {
             draw_list_3d._VtxWritePtr[0].pos.x = p.x + Marker[i].x * Size;
             draw_list_3d._VtxWritePtr[0].pos.y = p.y + Marker[i].y * Size;
             draw_list_3d._VtxWritePtr[0].uv = UV;
-            draw_list_3d._VtxWritePtr[0].col = Col;
+            draw_list_3d._VtxWritePtr[0].col = col;
             draw_list_3d._VtxWritePtr++;
         }
         // 3 indices per triangle
@@ -398,7 +1014,7 @@ template <class _Getter> struct RendererMarkersFill : RendererBase {
             draw_list_3d._IdxWritePtr[2] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + i);
             draw_list_3d._IdxWritePtr += 3;
             // Z
-            draw_list_3d._ZWritePtr[0] = GetPointDepth(p_plot);
+            draw_list_3d._ZWritePtr[0] = GetPointDepth(Plot, p_plot);
             draw_list_3d._ZWritePtr++;
         }
         // Update vertex count
@@ -424,11 +1040,12 @@ template <class _Getter> struct RendererMarkersLine : RendererBase {
         ImPlot3DPoint p_plot = Getter(prim);
         if (!cull_box.Contains(p_plot))
             return false;
-        ImVec2 p = PlotToPixels(p_plot);
+        ImVec2 p = PlotToPixels(Plot, p_plot);
+        const ImU32 col = GetPointColor(Getter, prim, Col);
         for (int i = 0; i < Count; i = i + 2) {
             ImVec2 p1(p.x + Marker[i].x * Size, p.y + Marker[i].y * Size);
             ImVec2 p2(p.x + Marker[i + 1].x * Size, p.y + Marker[i + 1].y * Size);
-            PrimLine(draw_list_3d, p1, p2, HalfWeight, Col, UV0, UV1, GetPointDepth(p_plot));
+            PrimLine(draw_list_3d, p1, p2, HalfWeight, col, UV0, UV1, GetPointDepth(Plot, p_plot));
         }
         return true;
     }
@@ -452,6 +1069,8 @@ template <class _Getter> struct RendererLineStrip : RendererBase {
 
     void Init(ImDrawList3D& draw_list_3d) const { GetLineRenderProps(draw_list_3d, HalfWeight, UV0, UV1); }
 
+    void Seek(int prim) const { P1_plot = Getter(prim); }
+
     IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
         ImPlot3DPoint P2_plot = Getter(prim + 1);
 
@@ -461,10 +1080,11 @@ template <class _Getter> struct RendererLineStrip : RendererBase {
 
         if (visible) {
             // Convert clipped points to pixel coordinates
-            ImVec2 P1_screen = PlotToPixels(P1_clipped);
-            ImVec2 P2_screen = PlotToPixels(P2_clipped);
+            ImVec2 P1_screen = PlotToPixels(Plot, P1_clipped);
+            ImVec2 P2_screen = PlotToPixels(Plot, P2_clipped);
             // Render the line segment
-            PrimLine(draw_list_3d, P1_screen, P2_screen, HalfWeight, Col, UV0, UV1, GetPointDepth((P1_plot + P2_plot) * 0.5f));
+            PrimLine(draw_list_3d, P1_screen, P2_screen, HalfWeight, GetPointColor(Getter, prim, Col), GetPointColor(Getter, prim + 1, Col), UV0,
+                     UV1, GetPointDepth(Plot, (P1_plot + P2_plot) * 0.5f));
         }
 
         // Update for next segment
@@ -486,10 +1106,19 @@ template <class _Getter> struct RendererLineStripSkip : RendererBase {
         : RendererBase(getter.Count - 1, 6, 4), Getter(getter), Col(col), HalfWeight(ImMax(1.0f, weight) * 0.5f) {
         // Initialize the first point in plot coordinates
         P1_plot = Getter(0);
+        P1_idx = 0;
     }
 
     void Init(ImDrawList3D& draw_list_3d) const { GetLineRenderProps(draw_list_3d, HalfWeight, UV0, UV1); }
 
+    void Seek(int prim) const {
+        // Continue from the last valid point, as segments are bridged over NaN points
+        P1_plot = Getter(prim);
+        while (prim > 0 && (ImNan(P1_plot.x) || ImNan(P1_plot.y) || ImNan(P1_plot.z)))
+            P1_plot = Getter(--prim);
+        P1_idx = prim;
+    }
+
     IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
         // Get the next point in plot coordinates
         ImPlot3DPoint P2_plot = Getter(prim + 1);
@@ -504,16 +1133,19 @@ template <class _Getter> struct RendererLineStripSkip : RendererBase {
 
             if (visible) {
                 // Convert clipped points to pixel coordinates
-                ImVec2 P1_screen = PlotToPixels(P1_clipped);
-                ImVec2 P2_screen = PlotToPixels(P2_clipped);
+                ImVec2 P1_screen = PlotToPixels(Plot, P1_clipped);
+                ImVec2 P2_screen = PlotToPixels(Plot, P2_clipped);
                 // Render the line segment
-                PrimLine(draw_list_3d, P1_screen, P2_screen, HalfWeight, Col, UV0, UV1, GetPointDepth((P1_plot + P2_plot) * 0.5f));
+                PrimLine(draw_list_3d, P1_screen, P2_screen, HalfWeight, GetPointColor(Getter, P1_idx, Col), GetPointColor(Getter, prim + 1, Col),
+                         UV0, UV1, GetPointDepth(Plot, (P1_plot + P2_plot) * 0.5f));
             }
         }
 
         // Update P1_plot if P2_plot is valid
-        if (!ImNan(P2_plot.x) && !ImNan(P2_plot.y) && !ImNan(P2_plot.z))
+        if (!ImNan(P2_plot.x) && !ImNan(P2_plot.y) && !ImNan(P2_plot.z)) {
             P1_plot = P2_plot;
+            P1_idx = prim + 1;
+        }
 
         return visible;
     }
@@ -522,6 +1154,7 @@ template <class _Getter> struct RendererLineStripSkip : RendererBase {
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImPlot3DPoint P1_plot;
+    mutable int P1_idx; // Index of P1_plot, for its color
     mutable ImVec2 UV0;
     mutable ImVec2 UV1;
 };
@@ -546,10 +1179,11 @@ template <class _Getter> struct RendererLineSegments : RendererBase {
 
             if (visible) {
                 // Convert clipped points to pixel coordinates
-                ImVec2 P1_screen = PlotToPixels(P1_clipped);
-                ImVec2 P2_screen = PlotToPixels(P2_clipped);
+                ImVec2 P1_screen = PlotToPixels(Plot, P1_clipped);
+                ImVec2 P2_screen = PlotToPixels(Plot, P2_clipped);
                 // Render the line segment
-                PrimLine(draw_list_3d, P1_screen, P2_screen, HalfWeight, Col, UV0, UV1, GetPointDepth((P1_plot + P2_plot) * 0.5f));
+                PrimLine(draw_list_3d, P1_screen, P2_screen, HalfWeight, GetPointColor(Getter, prim * 2 + 0, Col),
+                         GetPointColor(Getter, prim * 2 + 1, Col), UV0, UV1, GetPointDepth(Plot, (P1_plot + P2_plot) * 0.5f));
             }
             return visible;
         }
@@ -581,23 +1215,23 @@ template <class _Getter> struct RendererTriangleFill : RendererBase {
 
         // Project the triangle vertices to screen space
         ImVec2 p[3];
-        p[0] = PlotToPixels(p_plot[0]);
-        p[1] = PlotToPixels(p_plot[1]);
-        p[2] = PlotToPixels(p_plot[2]);
+        p[0] = PlotToPixels(Plot, p_plot[0]);
+        p[1] = PlotToPixels(Plot, p_plot[1]);
+        p[2] = PlotToPixels(Plot, p_plot[2]);
 
         // 3 vertices per triangle
         draw_list_3d._VtxWritePtr[0].pos.x = p[0].x;
         draw_list_3d._VtxWritePtr[0].pos.y = p[0].y;
         draw_list_3d._VtxWritePtr[0].uv = UV;
-        draw_list_3d._VtxWritePtr[0].col = Col;
+        draw_list_3d._VtxWritePtr[0].col = GetPointColor(Getter, 3 * prim + 0, Col);
         draw_list_3d._VtxWritePtr[1].pos.x = p[1].x;
         draw_list_3d._VtxWritePtr[1].pos.y = p[1].y;
         draw_list_3d._VtxWritePtr[1].uv = UV;
-        draw_list_3d._VtxWritePtr[1].col = Col;
+        draw_list_3d._VtxWritePtr[1].col = GetPointColor(Getter, 3 * prim + 1, Col);
         draw_list_3d._VtxWritePtr[2].pos.x = p[2].x;
         draw_list_3d._VtxWritePtr[2].pos.y = p[2].y;
         draw_list_3d._VtxWritePtr[2].uv = UV;
-        draw_list_3d._VtxWritePtr[2].col = Col;
+        draw_list_3d._VtxWritePtr[2].col = GetPointColor(Getter, 3 * prim + 2, Col);
         draw_list_3d._VtxWritePtr += 3;
 
         // 3 indices per triangle
@@ -606,7 +1240,7 @@ template <class _Getter> struct RendererTriangleFill : RendererBase {
         draw_list_3d._IdxWritePtr[2] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 2);
         draw_list_3d._IdxWritePtr += 3;
         // 1 Z per vertex
-        draw_list_3d._ZWritePtr[0] = GetPointDepth((p_plot[0] + p_plot[1] + p_plot[2]) / 3);
+        draw_list_3d._ZWritePtr[0] = GetPointDepth(Plot, (p_plot[0] + p_plot[1] + p_plot[2]) / 3);
         draw_list_3d._ZWritePtr++;
 
         // Update vertex count
@@ -638,31 +1272,31 @@ template <class _Getter> struct RendererQuadFill : RendererBase {
 
         // Project the quad vertices to screen space
         ImVec2 p[4];
-        p[0] = PlotToPixels(p_plot[0]);
-        p[1] = PlotToPixels(p_plot[1]);
-        p[2] = PlotToPixels(p_plot[2]);
-        p[3] = PlotToPixels(p_plot[3]);
+        p[0] = PlotToPixels(Plot, p_plot[0]);
+        p[1] = PlotToPixels(Plot, p_plot[1]);
+        p[2] = PlotToPixels(Plot, p_plot[2]);
+        p[3] = PlotToPixels(Plot, p_plot[3]);
 
         // Add vertices for two triangles
         draw_list_3d._VtxWritePtr[0].pos.x = p[0].x;
         draw_list_3d._VtxWritePtr[0].pos.y = p[0].y;
         draw_list_3d._VtxWritePtr[0].uv = UV;
-        draw_list_3d._VtxWritePtr[0].col = Col;
+        draw_list_3d._VtxWritePtr[0].col = GetPointColor(Getter, 4 * prim + 0, Col);
 
         draw_list_3d._VtxWritePtr[1].pos.x = p[1].x;
         draw_list_3d._VtxWritePtr[1].pos.y = p[1].y;
         draw_list_3d._VtxWritePtr[1].uv = UV;
-        draw_list_3d._VtxWritePtr[1].col = Col;
+        draw_list_3d._VtxWritePtr[1].col = GetPointColor(Getter, 4 * prim + 1, Col);
 
         draw_list_3d._VtxWritePtr[2].pos.x = p[2].x;
         draw_list_3d._VtxWritePtr[2].pos.y = p[2].y;
         draw_list_3d._VtxWritePtr[2].uv = UV;
-        draw_list_3d._VtxWritePtr[2].col = Col;
+        draw_list_3d._VtxWritePtr[2].col = GetPointColor(Getter, 4 * prim + 2, Col);
 
         draw_list_3d._VtxWritePtr[3].pos.x = p[3].x;
         draw_list_3d._VtxWritePtr[3].pos.y = p[3].y;
         draw_list_3d._VtxWritePtr[3].uv = UV;
-        draw_list_3d._VtxWritePtr[3].col = Col;
+        draw_list_3d._VtxWritePtr[3].col = GetPointColor(Getter, 4 * prim + 3, Col);
 
         draw_list_3d._VtxWritePtr += 4;
 
@@ -678,7 +1312,7 @@ template <class _Getter> struct RendererQuadFill : RendererBase {
         draw_list_3d._IdxWritePtr += 6;
 
         // Add depth value for the quad
-        float z = GetPointDepth((p_plot[0] + p_plot[1] + p_plot[2] + p_plot[3]) / 4.0f);
+        float z = GetPointDepth(Plot, (p_plot[0] + p_plot[1] + p_plot[2] + p_plot[3]) / 4.0f);
         draw_list_3d._ZWritePtr[0] = z;
         draw_list_3d._ZWritePtr[1] = z;
         draw_list_3d._ZWritePtr += 2;
@@ -699,6 +1333,9 @@ template <class _Getter> struct RendererQuadImage : RendererBase {
                       ImU32 col)
         : RendererBase(getter.Count / 4, 6, 4), Getter(getter), TexRef(tex_ref), UV0(uv0), UV1(uv1), UV2(uv2), UV3(uv3), Col(col) {}
 
+    // Textures are assigned in primitive order
+    static constexpr bool Parallel = false;
+
     void Init(ImDrawList3D& draw_list_3d) const {}
 
     IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
@@ -717,10 +1354,10 @@ template <class _Getter> struct RendererQuadImage : RendererBase {
 
         // Project the quad vertices to screen space
         ImVec2 p[4];
-        p[0] = PlotToPixels(p_plot[0]);
-        p[1] = PlotToPixels(p_plot[1]);
-        p[2] = PlotToPixels(p_plot[2]);
-        p[3] = PlotToPixels(p_plot[3]);
+        p[0] = PlotToPixels(Plot, p_plot[0]);
+        p[1] = PlotToPixels(Plot, p_plot[1]);
+        p[2] = PlotToPixels(Plot, p_plot[2]);
+        p[3] = PlotToPixels(Plot, p_plot[3]);
 
         // Add vertices for two triangles
         draw_list_3d._VtxWritePtr[0].pos.x = p[0].x;
@@ -757,7 +1394,7 @@ template <class _Getter> struct RendererQuadImage : RendererBase {
         draw_list_3d._IdxWritePtr += 6;
 
         // Add depth value for the quad
-        float z = GetPointDepth((p_plot[0] + p_plot[1] + p_plot[2] + p_plot[3]) / 4.0f);
+        float z = GetPointDepth(Plot, (p_plot[0] + p_plot[1] + p_plot[2] + p_plot[3]) / 4.0f);
         draw_list_3d._ZWritePtr[0] = z;
         draw_list_3d._ZWritePtr[1] = z;
         draw_list_3d._ZWritePtr += 2;
@@ -778,64 +1415,42 @@ template <class _Getter> struct RendererQuadImage : RendererBase {
 };
 
 template <class _Getter> struct RendererSurfaceFill : RendererBase {
-    RendererSurfaceFill(const _Getter& getter, int x_count, int y_count, ImU32 col, double scale_min, double scale_max)
-        : RendererBase((x_count - 1) * (y_count - 1), 6, 4), Getter(getter), XCount(x_count), YCount(y_count), Col(col), ScaleMin(scale_min),
-          ScaleMax(scale_max) {}
+    RendererSurfaceFill(const _Getter& getter, int x_count, int y_count, ImU32 col)
+        : RendererBase((x_count - 1) * (y_count - 1), 6, 4), Getter(getter), XCount(x_count), YCount(y_count), Col(col) {}
 
-    void Init(ImDrawList3D& draw_list_3d) const {
-        UV = draw_list_3d._SharedData->TexUvWhitePixel;
-
-        // Compute min and max values for the colormap (if not solid fill)
-        const ImPlot3DNextItemData& n = GetItemData();
-        if (n.IsAutoFill) {
-            Min = FLT_MAX;
-            Max = -FLT_MAX;
-            for (int i = 0; i < Getter.Count; i++) {
-                float z = Getter(i).z;
-                Min = ImMin(Min, z);
-                Max = ImMax(Max, z);
-            }
-        }
-    }
+    void Init(ImDrawList3D& draw_list_3d) const { UV = draw_list_3d._SharedData->TexUvWhitePixel; }
 
     IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
         int x = prim % (XCount - 1);
         int y = prim / (XCount - 1);
 
+        int idx[4];
+        idx[0] = x + y * XCount;
+        idx[1] = x + 1 + y * XCount;
+        idx[2] = x + 1 + (y + 1) * XCount;
+        idx[3] = x + (y + 1) * XCount;
+
         ImPlot3DPoint p_plot[4];
-        p_plot[0] = Getter(x + y * XCount);
-        p_plot[1] = Getter(x + 1 + y * XCount);
-        p_plot[2] = Getter(x + 1 + (y + 1) * XCount);
-        p_plot[3] = Getter(x + (y + 1) * XCount);
+        p_plot[0] = Getter(idx[0]);
+        p_plot[1] = Getter(idx[1]);
+        p_plot[2] = Getter(idx[2]);
+        p_plot[3] = Getter(idx[3]);
 
         // Check if the quad is outside the culling box
         if (!cull_box.Contains(p_plot[0]) && !cull_box.Contains(p_plot[1]) && !cull_box.Contains(p_plot[2]) && !cull_box.Contains(p_plot[3]))
             return false;
 
-        // Compute colors
-        ImU32 cols[4] = {Col, Col, Col, Col};
-        const ImPlot3DNextItemData& n = GetItemData();
-        if (n.IsAutoFill) {
-            float alpha = GImPlot3D->NextItemData.FillAlpha;
-            float min = Min;
-            float max = Max;
-            if (ScaleMin != 0.0 || ScaleMax != 0.0) {
-                min = (float)ScaleMin;
-                max = (float)ScaleMax;
-            }
-            for (int i = 0; i < 4; i++) {
-                ImVec4 col = SampleColormap(ImClamp(ImRemap01(p_plot[i].z, min, max), 0.0f, 1.0f));
-                col.w *= alpha;
-                cols[i] = ImGui::ColorConvertFloat4ToU32(col);
-            }
-        }
+        // Colors of the corners (computed once per vertex for colormapped surfaces, see ComputePointColors())
+        ImU32 cols[4];
+        for (int i = 0; i < 4; i++)
+            cols[i] = GetPointColor(Getter, idx[i], Col);
 
         // Project the quad vertices to screen space
         ImVec2 p[4];
-        p[0] = PlotToPixels(p_plot[0]);
-        p[1] = PlotToPixels(p_plot[1]);
-        p[2] = PlotToPixels(p_plot[2]);
-        p[3] = PlotToPixels(p_plot[3]);
+        p[0] = PlotToPixels(Plot, p_plot[0]);
+        p[1] = PlotToPixels(Plot, p_plot[1]);
+        p[2] = PlotToPixels(Plot, p_plot[2]);
+        p[3] = PlotToPixels(Plot, p_plot[3]);
 
         // Add vertices for two triangles
         draw_list_3d._VtxWritePtr[0].pos.x = p[0].x;
@@ -872,8 +1487,8 @@ template <class _Getter> struct RendererSurfaceFill : RendererBase {
         draw_list_3d._IdxWritePtr += 6;
 
         // Add depth values for the two triangles
-        draw_list_3d._ZWritePtr[0] = GetPointDepth((p_plot[0] + p_plot[1] + p_plot[2]) / 3.0f);
-        draw_list_3d._ZWritePtr[1] = GetPointDepth((p_plot[0] + p_plot[2] + p_plot[3]) / 3.0f);
+        draw_list_3d._ZWritePtr[0] = GetPointDepth(Plot, (p_plot[0] + p_plot[1] + p_plot[2]) / 3.0f);
+        draw_list_3d._ZWritePtr[1] = GetPointDepth(Plot, (p_plot[0] + p_plot[2] + p_plot[3]) / 3.0f);
         draw_list_3d._ZWritePtr += 2;
 
         // Update vertex count
@@ -884,13 +1499,93 @@ template <class _Getter> struct RendererSurfaceFill : RendererBase {
 
     const _Getter& Getter;
     mutable ImVec2 UV;
-    mutable float Min; // Minimum value for the colormap
-    mutable float Max; // Minimum value for the colormap
     const int XCount;
     const int YCount;
     const ImU32 Col;
-    const double ScaleMin;
-    const double ScaleMax;
+};
+
+template <class _Getter> struct RendererMeshFill : RendererBase {
+    RendererMeshFill(const _Getter& getter, ImU32 col, const ImU32* shades)
+        : RendererBase(getter.Count / 3, 3, 3), Getter(getter), Col(col), Shades(shades) {}
+
+    void Init(ImDrawList3D& draw_list_3d) const { UV = draw_list_3d._SharedData->TexUvWhitePixel; }
+
+    IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
+        IM_UNUSED(cull_box);
+        const ImPlot3DMesh& mesh = Getter.Mesh;
+        const unsigned int* tri = Getter.Idx + 3 * prim;
+
+        // Check if the triangle is outside the culling box
+        if (!mesh.ProjectedInside.Data[tri[0]] && !mesh.ProjectedInside.Data[tri[1]] && !mesh.ProjectedInside.Data[tri[2]])
+            return false;
+
+        // 3 vertices per triangle, already projected to screen space
+        for (int i = 0; i < 3; i++) {
+            const ImVec2& p = mesh.ProjectedPixels.Data[tri[i]];
+            draw_list_3d._VtxWritePtr[i].pos.x = p.x;
+            draw_list_3d._VtxWritePtr[i].pos.y = p.y;
+            draw_list_3d._VtxWritePtr[i].uv = UV;
+            draw_list_3d._VtxWritePtr[i].col = Shades != nullptr ? ShadeColor(Col, Shades[tri[i]]) : Col;
+        }
+        draw_list_3d._VtxWritePtr += 3;
+
+        // 3 indices per triangle
+        draw_list_3d._IdxWritePtr[0] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx);
+        draw_list_3d._IdxWritePtr[1] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 1);
+        draw_list_3d._IdxWritePtr[2] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 2);
+        draw_list_3d._IdxWritePtr += 3;
+        // 1 Z per triangle, the depth of the centroid
+        const float* depths = mesh.ProjectedDepths.Data;
+        draw_list_3d._ZWritePtr[0] = (depths[tri[0]] + depths[tri[1]] + depths[tri[2]]) / 3;
+        draw_list_3d._ZWritePtr++;
+
+        // Update vertex count
+        draw_list_3d._VtxCurrentIdx += 3;
+
+        return true;
+    }
+
+    const _Getter& Getter;
+    mutable ImVec2 UV;
+    const ImU32 Col;
+    const ImU32* Shades; // Shade of each vertex (nullptr if not shaded)
+};
+
+template <class _Getter> struct RendererMeshEdges : RendererBase {
+    RendererMeshEdges(const _Getter& getter, ImU32 col, float weight)
+        : RendererBase(getter.Count / 2, 6, 4), Getter(getter), Col(col), HalfWeight(ImMax(1.0f, weight) * 0.5f) {}
+
+    void Init(ImDrawList3D& draw_list_3d) const { GetLineRenderProps(draw_list_3d, HalfWeight, UV0, UV1); }
+
+    IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
+        const ImPlot3DMesh& mesh = Getter.Mesh;
+        const unsigned int a = Getter.Idx[2 * prim + 0];
+        const unsigned int b = Getter.Idx[2 * prim + 1];
+        const float z = (mesh.ProjectedDepths.Data[a] + mesh.ProjectedDepths.Data[b]) * 0.5f;
+
+        // Edges inside the culling box use the projected vertices
+        if (mesh.ProjectedInside.Data[a] && mesh.ProjectedInside.Data[b]) {
+            PrimLine(draw_list_3d, mesh.ProjectedPixels.Data[a], mesh.ProjectedPixels.Data[b], HalfWeight, Col, UV0, UV1, z);
+            return true;
+        }
+
+        // Other edges are clipped to the culling box
+        const ImPlot3DPoint& P1_plot = mesh.Vertices.Data[a];
+        const ImPlot3DPoint& P2_plot = mesh.Vertices.Data[b];
+        if (ImNan(P1_plot.x) || ImNan(P1_plot.y) || ImNan(P1_plot.z) || ImNan(P2_plot.x) || ImNan(P2_plot.y) || ImNan(P2_plot.z))
+            return false;
+        ImPlot3DPoint P1_clipped, P2_clipped;
+        if (!cull_box.ClipLineSegment(P1_plot, P2_plot, P1_clipped, P2_clipped))
+            return false;
+        PrimLine(draw_list_3d, PlotToPixels(Plot, P1_clipped), PlotToPixels(Plot, P2_clipped), HalfWeight, Col, UV0, UV1, z);
+        return true;
+    }
+
+    const _Getter& Getter;
+    const ImU32 Col;
+    mutable float HalfWeight;
+    mutable ImVec2 UV0;
+    mutable ImVec2 UV1;
 };
 
 //-----------------------------------------------------------------------------
@@ -909,14 +1604,25 @@ template <typename T> IMPLOT3D_INLINE T IndexData(const T* data, int idx, int co
 }
 
 template <typename T> struct IndexerIdx {
-    IndexerIdx(const T* data, int count, int offset = 0, int stride = sizeof(T)) : Data(data), Count(count), Offset(offset), Stride(stride) {}
-    template <typename I> IMPLOT3D_INLINE double operator()(I idx) const { return (double)IndexData(Data, idx, Count, Offset, Stride); }
+    IndexerIdx(const T* data, int count, int offset = 0, int stride = sizeof(T), double scale = 1.0, double bias = 0.0)
+        : Data(data), Count(count), Offset(offset), Stride(stride), Scale(scale), Bias(bias) {}
+    template <typename I> IMPLOT3D_INLINE double operator()(I idx) const {
+        return (double)IndexData(Data, idx, Count, Offset, Stride) * Scale + Bias;
+    }
     const T* Data;
     int Count;
     int Offset;
     int Stride;
+    double Scale; // Decoding of the data (value * Scale + Bias)
+    double Bias;
 };
 
+// Indexer of the data of the next item along an axis, decoded with the scale set by SetNextItemDataScale()
+template <typename T> IMPLOT3D_INLINE IndexerIdx<T> NextItemIndexer(ImAxis3D axis, const T* data, int count, int offset, int stride) {
+    const ImPlot3DNextItemData& n = GImPlot3D->NextItemData;
+    return IndexerIdx<T>(data, count, offset, stride, n.DataScale[axis], n.DataOffset[axis]);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Getters
 //-----------------------------------------------------------------------------
@@ -942,40 +1648,173 @@ template <typename _Getter> struct GetterLoop {
     const int Count;
 };
 
-template <typename _Getter> struct GetterTriangleLines {
-    GetterTriangleLines(_Getter getter) : Getter(getter), Count(getter.Count * 2) {}
-    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
-        idx = ((idx % 6 + 1) / 2) % 3 + idx / 6 * 3;
-        return Getter(idx);
-    }
+template <typename _Getter> IMPLOT3D_INLINE ImU32 GetPointColor(const GetterLoop<_Getter>& getter, int idx, ImU32 col) {
+    return GetPointColor(getter.Getter, idx % (getter.Count - 1), col);
+}
+
+// Adds a color to each point of a getter, computed by the colorer from the point index and the item color
+template <typename _Getter, typename _Colorer> struct GetterColored {
+    GetterColored(const _Getter& getter, const _Colorer& colorer) : Getter(getter), Colorer(colorer), Count(getter.Count) {}
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const { return Getter(idx); }
     const _Getter Getter;
+    const _Colorer Colorer;
     const int Count;
 };
 
-template <typename _Getter> struct GetterQuadLines {
-    GetterQuadLines(_Getter getter) : Getter(getter), Count(getter.Count * 2) {}
-    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
-        idx = ((idx % 8 + 1) / 2) % 4 + idx / 8 * 4;
-        return Getter(idx);
+template <typename _Getter, typename _Colorer>
+IMPLOT3D_INLINE ImU32 GetPointColor(const GetterColored<_Getter, _Colorer>& getter, int idx, ImU32 col) {
+    return getter.Colorer(idx, col);
+}
+
+// Fades the item color from transparent at the first point to the item alpha at the last point (e.g. for trails)
+struct ColorerFade {
+    ColorerFade(int count) : FadeScale(1.0f / count) {}
+    IMPLOT3D_INLINE ImU32 operator()(int idx, ImU32 col) const { return ScaleColorAlpha(col, (idx + 1) * FadeScale); }
+    const float FadeScale;
+};
+
+// Colors each point from a value mapped to an entry of the current colormap table (see ImPlot3DColormapLUT), with the alpha of the item color.
+// The automatic scale needs a pass over all the values, so the table is only set up by Prepare(), once the item is known to be rendered
+template <typename _Indexer> struct ColorerValues {
+    ColorerValues(const _Indexer& values, int count, double scale_min, double scale_max, bool fade)
+        : Values(values), Count(count), ScaleMin(scale_min), ScaleMax(scale_max) {
+        FadeScale = fade ? 1.0f / count : 0.0f;
     }
-    const _Getter Getter;
+    void Prepare() const {
+        const ImPlot3DContext& gp = *GImPlot3D;
+        double scale_min = ScaleMin, scale_max = ScaleMax;
+        if (scale_min == 0.0 && scale_max == 0.0) {
+            scale_min = DBL_MAX;
+            scale_max = -DBL_MAX;
+            for (int i = 0; i < Count; i++) {
+                const double v = Values(i);
+                if (v >= -DBL_MAX && v <= DBL_MAX) {
+                    scale_min = ImMin(scale_min, v);
+                    scale_max = ImMax(scale_max, v);
+                }
+            }
+        }
+        LUT = ImPlot3DColormapLUT(gp.ColormapData, gp.Style.Colormap, scale_min, scale_max);
+    }
+    IMPLOT3D_INLINE ImU32 operator()(int idx, ImU32 col) const {
+        float alpha = (float)((col >> IM_COL32_A_SHIFT) & 0xFF) * (1.0f / 255.0f);
+        if (FadeScale != 0.0f)
+            alpha *= (idx + 1) * FadeScale;
+        return ScaleColorAlpha(LUT(Values(idx)), alpha);
+    }
+    const _Indexer Values;
     const int Count;
+    const double ScaleMin, ScaleMax;
+    float FadeScale;
+    mutable ImPlot3DColormapLUT LUT; // Set up by Prepare()
 };
 
-template <typename _Getter> struct GetterSurfaceLines {
-    GetterSurfaceLines(_Getter getter, int x_count, int y_count) : Getter(getter), XCount(x_count), YCount(y_count) {
-        int horizontal_segments = (XCount - 1) * YCount;
-        int vertical_segments = (YCount - 1) * XCount;
-        int segments = horizontal_segments + vertical_segments;
-        Count = segments * 2; // Each segment has 2 endpoints
-    }
+// Prepares the colorer of a getter once its item is known to be rendered (after BeginItemEx()). Only colorers with a Prepare() step need it
+template <typename _Colorer> IMPLOT3D_INLINE void PrepareColorer(const _Colorer&) {}
+template <typename _Indexer> IMPLOT3D_INLINE void PrepareColorer(const ColorerValues<_Indexer>& colorer) { colorer.Prepare(); }
+template <typename _Getter> IMPLOT3D_INLINE void PrepareColors(const _Getter&) {}
+template <typename _Getter, typename _Colorer> IMPLOT3D_INLINE void PrepareColors(const GetterColored<_Getter, _Colorer>& getter) {
+    PrepareColorer(getter.Colorer);
+}
 
-    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
-        // idx is an endpoint index
-        int endpoint_i = (int)(idx % 2);
-        int segment_i = (int)(idx / 2);
+// Reads the color of each point from an array of colors
+struct ColorerTable {
+    ColorerTable(const ImU32* colors) : Colors(colors) {}
+    IMPLOT3D_INLINE ImU32 operator()(int idx, ImU32) const { return Colors[idx]; }
+    const ImU32* Colors;
+};
 
-        int horizontal_segments = (XCount - 1) * YCount;
+// Reads the color of each triangle corner from the colors of the mesh vertices, with their alpha scaled by the alpha of the item color
+struct ColorerIndexed {
+    ColorerIndexed(const ImU32* colors, const unsigned int* idx) : Colors(colors), Idx(idx) {}
+    IMPLOT3D_INLINE ImU32 operator()(int idx, ImU32 col) const {
+        const ImU32 vtx_col = Colors[Idx[idx]];
+        if ((col & IM_COL32_A_MASK) == IM_COL32_A_MASK)
+            return vtx_col;
+        return ScaleColorAlpha(vtx_col, (float)((col >> IM_COL32_A_SHIFT) & 0xFF) * (1.0f / 255.0f));
+    }
+    const ImU32* Colors;
+    const unsigned int* Idx;
+};
+
+// Shades the color of each triangle corner by the shade of its vertex (see ShadeVertices()). Without indices, corner i is vertex i
+template <typename _Getter> struct ColorerShaded {
+    ColorerShaded(const _Getter& getter, const ImU32* shades, const unsigned int* idx) : Getter(getter), Shades(shades), Idx(idx) {}
+    IMPLOT3D_INLINE ImU32 operator()(int idx, ImU32 col) const {
+        return ShadeColor(GetPointColor(Getter, idx, col), Shades[Idx != nullptr ? Idx[idx] : (unsigned int)idx]);
+    }
+    const _Getter& Getter;
+    const ImU32* Shades;
+    const unsigned int* Idx;
+};
+
+// Heights of the points of a getter, the values colormapped by default on surfaces
+template <typename _Getter> struct IndexerGetterZ {
+    IndexerGetterZ(const _Getter& getter) : Getter(getter) {}
+    template <typename I> IMPLOT3D_INLINE double operator()(I idx) const { return Getter(idx).z; }
+    const _Getter& Getter;
+};
+
+// Computes the color of each point once in a scratch buffer, for items whose vertices are shared by several primitives. The buffer is valid
+// until the next item is plotted
+template <typename _Colorer> ImU32* ComputePointColors(const _Colorer& colorer, int count, ImU32 col) {
+    ImVector<ImU32>& colors = GImPlot3D->TempColors;
+    colors.resize(count);
+    for (int i = 0; i < count; i++)
+        colors.Data[i] = colorer(i, col);
+    return colors.Data;
+}
+
+// Colors each triangle corner from the value of its vertex. Each vertex is shared by several triangles, so Prepare() computes its color once
+// (opaque, the alpha of the item color is applied per corner)
+struct ColorerIndexedValues {
+    ColorerIndexedValues(const float* values, int vtx_count, double scale_min, double scale_max, const unsigned int* idx)
+        : Values(IndexerIdx<float>(values, vtx_count), vtx_count, scale_min, scale_max, false), Indexed(nullptr, idx) {}
+    void Prepare() const {
+        Values.Prepare();
+        Indexed.Colors = ComputePointColors(Values, Values.Count, IM_COL32_WHITE);
+    }
+    IMPLOT3D_INLINE ImU32 operator()(int idx, ImU32 col) const { return Indexed(idx, col); }
+    const ColorerValues<IndexerIdx<float>> Values;
+    mutable ColorerIndexed Indexed; // Colors set by Prepare()
+};
+
+IMPLOT3D_INLINE void PrepareColorer(const ColorerIndexedValues& colorer) { colorer.Prepare(); }
+
+template <typename _Getter> struct GetterTriangleLines {
+    GetterTriangleLines(_Getter getter) : Getter(getter), Count(getter.Count * 2) {}
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
+        idx = ((idx % 6 + 1) / 2) % 3 + idx / 6 * 3;
+        return Getter(idx);
+    }
+    const _Getter Getter;
+    const int Count;
+};
+
+template <typename _Getter> struct GetterQuadLines {
+    GetterQuadLines(_Getter getter) : Getter(getter), Count(getter.Count * 2) {}
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
+        idx = ((idx % 8 + 1) / 2) % 4 + idx / 8 * 4;
+        return Getter(idx);
+    }
+    const _Getter Getter;
+    const int Count;
+};
+
+template <typename _Getter> struct GetterSurfaceLines {
+    GetterSurfaceLines(_Getter getter, int x_count, int y_count) : Getter(getter), XCount(x_count), YCount(y_count) {
+        int horizontal_segments = (XCount - 1) * YCount;
+        int vertical_segments = (YCount - 1) * XCount;
+        int segments = horizontal_segments + vertical_segments;
+        Count = segments * 2; // Each segment has 2 endpoints
+    }
+
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
+        // idx is an endpoint index
+        int endpoint_i = (int)(idx % 2);
+        int segment_i = (int)(idx / 2);
+
+        int horizontal_segments = (XCount - 1) * YCount;
 
         int px, py;
         if (segment_i < horizontal_segments) {
@@ -1004,6 +1843,36 @@ template <typename _Getter> struct GetterSurfaceLines {
     const int YCount;
 };
 
+// Vertices of a regular surface grid, only the heights are read from the data
+template <typename _IndexerZ> struct GetterGridZ {
+    GetterGridZ(_IndexerZ z, int x_count, int y_count, double x_min, double x_max, double y_min, double y_max)
+        : IndexerZ(z), XCount(x_count), XMin(x_min), YMin(y_min), XStep(x_count > 1 ? (x_max - x_min) / (x_count - 1) : 0.0),
+          YStep(y_count > 1 ? (y_max - y_min) / (y_count - 1) : 0.0), Count(x_count * y_count) {}
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
+        const int x = (int)idx % XCount;
+        const int y = (int)idx / XCount;
+        return ImPlot3DPoint((float)(XMin + x * XStep), (float)(YMin + y * YStep), (float)IndexerZ(idx));
+    }
+    const _IndexerZ IndexerZ;
+    const int XCount;
+    const double XMin, YMin;
+    const double XStep, YStep;
+    const int Count;
+};
+
+// Fits the heights of a regular surface grid, alternating between the grid corners for x and y instead of computing the vertices
+template <typename _IndexerZ> struct FitterGridZ {
+    FitterGridZ(_IndexerZ z, int count, double x_min, double x_max, double y_min, double y_max)
+        : IndexerZ(z), Min((float)x_min, (float)y_min, 0.0f), Max((float)x_max, (float)y_max, 0.0f), Count(count) {}
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
+        const ImPlot3DPoint& corner = (idx & 1) ? Max : Min;
+        return ImPlot3DPoint(corner.x, corner.y, (float)IndexerZ(idx));
+    }
+    const _IndexerZ IndexerZ;
+    const ImPlot3DPoint Min, Max;
+    const int Count;
+};
+
 struct Getter3DPoints {
     Getter3DPoints(const ImPlot3DPoint* points, int count) : Points(points), Count(count) {}
     template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const { return Points[idx]; }
@@ -1011,6 +1880,36 @@ struct Getter3DPoints {
     const int Count;
 };
 
+struct GetterStream {
+    GetterStream(const ImPlot3DStream& stream) : Data(stream.Data.Data), Offset(stream.Offset), Count(stream.Data.Size) {}
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
+        int i = Offset + (int)idx;
+        return Data[i < Count ? i : i - Count];
+    }
+    const ImPlot3DPoint* Data;
+    const int Offset;
+    const int Count;
+};
+
+// Fits the stream bounds instead of every point of the stream
+struct FitterStream {
+    FitterStream(const ImPlot3DStream& stream) : Stream(stream), Count(2) {}
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
+        ImPlot3DBox bounds = Stream.GetBounds();
+        return idx == 0 ? bounds.Min : bounds.Max;
+    }
+    const ImPlot3DStream& Stream;
+    const int Count;
+};
+
+// Fits precomputed bounds instead of every point
+struct FitterBox {
+    FitterBox(const ImPlot3DBox& box) : Box(box), Count(2) {}
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const { return idx == 0 ? Box.Min : Box.Max; }
+    const ImPlot3DBox Box;
+    const int Count;
+};
+
 struct GetterMeshTriangles {
     GetterMeshTriangles(const ImPlot3DPoint* vtx, const unsigned int* idx, int idx_count)
         : Vtx(vtx), Idx(idx), IdxCount(idx_count), TriCount(idx_count / 3), Count(idx_count) {}
@@ -1027,15 +1926,142 @@ struct GetterMeshTriangles {
     int Count;
 };
 
+// Vertex index of each triangle corner of a mesh getter (nullptr if each corner is its own vertex)
+template <typename _Getter> IMPLOT3D_INLINE const unsigned int* GetCornerIndices(const _Getter&) { return nullptr; }
+
+IMPLOT3D_INLINE const unsigned int* GetCornerIndices(const GetterMeshTriangles& getter) { return getter.Idx; }
+
+template <typename _Getter, typename _Colorer>
+IMPLOT3D_INLINE const unsigned int* GetCornerIndices(const GetterColored<_Getter, _Colorer>& getter) {
+    return GetCornerIndices(getter.Getter);
+}
+
+// Data identifying the vertices of a surface getter, used as the key of its cached normals (the heights for grids read from arrays)
+template <typename _IndexerX, typename _IndexerY, typename _IndexerZ>
+IMPLOT3D_INLINE const void* GetGetterData(const GetterXYZ<_IndexerX, _IndexerY, _IndexerZ>& getter) {
+    return getter.IndexerZ.Data;
+}
+
+template <typename _IndexerZ> IMPLOT3D_INLINE const void* GetGetterData(const GetterGridZ<_IndexerZ>& getter) { return getter.IndexerZ.Data; }
+
+IMPLOT3D_INLINE const void* GetGetterData(const Getter3DPoints& getter) { return getter.Points; }
+
+// Indices into the vertices of a registered mesh, read from the projection of the vertices (see ProjectMeshVertices())
+struct GetterMeshProjected {
+    GetterMeshProjected(const ImPlot3DMesh& mesh, const unsigned int* idx, int idx_count) : Mesh(mesh), Idx(idx), Count(idx_count) {}
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I i) const { return Mesh.Vertices.Data[Idx[i]]; }
+    const ImPlot3DMesh& Mesh;
+    const unsigned int* Idx;
+    const int Count;
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] RenderPrimitives
 //-----------------------------------------------------------------------------
 
-/// Renders primitive shapes
-template <template <class> class _Renderer, class _Getter, typename... Args> void RenderPrimitives(const _Getter& getter, Args... args) {
-    _Renderer<_Getter> renderer(getter, args...);
-    ImPlot3DPlot& plot = *GetCurrentPlot();
-    ImDrawList3D& draw_list_3d = plot.DrawList;
+// Minimum number of primitives per job when rendering an item in parallel
+static const unsigned int RENDER_PARALLEL_MIN_PRIMS = 16384;
+
+// Primitives rendered by one job of RenderPrimitivesParallel()
+struct RenderChunk {
+    unsigned int PrimBegin; // First primitive of the chunk
+    unsigned int PrimEnd;   // One past the last primitive of the chunk
+    int VtxCount;           // Number of vertices written
+    int IdxCount;           // Number of indices written
+    int ZCount;             // Number of depth values written
+    int NumCulled;          // Number of culled primitives
+    unsigned int VtxShift;  // Number of vertices culled before the chunk
+};
+
+template <class _Renderer> struct RenderChunksData {
+    const _Renderer* Renderer;
+    const ImDrawList3D* DrawList;
+    const ImPlot3DBox* CullBox;
+    ImDrawList3D* ChunkDrawLists;
+    RenderChunk* Chunks;
+};
+
+template <class _Renderer> void RenderChunkJob(int index, void* job_data) {
+    const RenderChunksData<_Renderer>& data = *(const RenderChunksData<_Renderer>*)job_data;
+    const ImDrawList3D& draw_list_3d = *data.DrawList;
+    RenderChunk& chunk = data.Chunks[index];
+
+    // Each chunk writes to its own slots of the reserved buffers, as if no primitive before it was culled
+    _Renderer renderer = *data.Renderer;
+    ImDrawList3D& chunk_draw_list = data.ChunkDrawLists[index];
+    chunk_draw_list._SharedData = draw_list_3d._SharedData;
+    chunk_draw_list._VtxCurrentIdx = draw_list_3d._VtxCurrentIdx + chunk.PrimBegin * renderer.VtxConsumed;
+    chunk_draw_list._VtxWritePtr = draw_list_3d._VtxWritePtr + chunk.PrimBegin * renderer.VtxConsumed;
+    chunk_draw_list._IdxWritePtr = draw_list_3d._IdxWritePtr + chunk.PrimBegin * renderer.IdxConsumed;
+    chunk_draw_list._ZWritePtr = draw_list_3d._ZWritePtr + chunk.PrimBegin * (renderer.IdxConsumed / 3);
+    const ImDrawVert* vtx_begin = chunk_draw_list._VtxWritePtr;
+    const ImDrawIdx* idx_begin = chunk_draw_list._IdxWritePtr;
+    const float* z_begin = chunk_draw_list._ZWritePtr;
+
+    renderer.Seek(chunk.PrimBegin);
+    chunk.NumCulled = 0;
+    for (unsigned int i = chunk.PrimBegin; i < chunk.PrimEnd; i++)
+        if (!renderer.Render(chunk_draw_list, *data.CullBox, i))
+            chunk.NumCulled++;
+
+    chunk.VtxCount = (int)(chunk_draw_list._VtxWritePtr - vtx_begin);
+    chunk.IdxCount = (int)(chunk_draw_list._IdxWritePtr - idx_begin);
+    chunk.ZCount = (int)(chunk_draw_list._ZWritePtr - z_begin);
+}
+
+template <class _Renderer> void ShiftChunkIndicesJob(int index, void* job_data) {
+    const RenderChunksData<_Renderer>& data = *(const RenderChunksData<_Renderer>*)job_data;
+    const RenderChunk& chunk = data.Chunks[index];
+    if (chunk.VtxShift == 0)
+        return;
+    ImDrawIdx* idx = data.DrawList->_IdxWritePtr + chunk.PrimBegin * data.Renderer->IdxConsumed;
+    for (int i = 0; i < chunk.IdxCount; i++)
+        idx[i] = (ImDrawIdx)(idx[i] - chunk.VtxShift);
+}
+
+/// Renders the reserved primitives in chunks on several jobs, producing the same output as the serial loop. Returns the number of culled
+/// primitives
+template <class _Renderer>
+int RenderPrimitivesParallel(const _Renderer& renderer, ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, unsigned int prims,
+                             int job_count) {
+    RenderChunk chunks[IMPLOT3D_MAX_JOBS];
+    for (int i = 0; i < job_count; i++) {
+        chunks[i].PrimBegin = (unsigned int)((ImU64)prims * i / job_count);
+        chunks[i].PrimEnd = (unsigned int)((ImU64)prims * (i + 1) / job_count);
+    }
+    RenderChunksData<_Renderer> data = {&renderer, &draw_list_3d, &cull_box, GImPlot3D->JobDrawLists, chunks};
+    ParallelFor(job_count, RenderChunkJob<_Renderer>, &data);
+
+    // Prefix sum of the vertices culled before each chunk, then shift the chunk indices accordingly
+    int num_culled = 0;
+    for (int i = 0; i < job_count; i++) {
+        chunks[i].VtxShift = num_culled * renderer.VtxConsumed;
+        num_culled += chunks[i].NumCulled;
+    }
+    if (num_culled > 0)
+        ParallelFor(job_count, ShiftChunkIndicesJob<_Renderer>, &data);
+
+    // Compact the chunks in order
+    ImDrawVert* vtx_reserved = draw_list_3d._VtxWritePtr;
+    ImDrawIdx* idx_reserved = draw_list_3d._IdxWritePtr;
+    float* z_reserved = draw_list_3d._ZWritePtr;
+    for (int i = 0; i < job_count; i++) {
+        const RenderChunk& chunk = chunks[i];
+        if (chunk.VtxShift != 0) {
+            memmove(draw_list_3d._VtxWritePtr, vtx_reserved + chunk.PrimBegin * renderer.VtxConsumed, chunk.VtxCount * sizeof(ImDrawVert));
+            memmove(draw_list_3d._IdxWritePtr, idx_reserved + chunk.PrimBegin * renderer.IdxConsumed, chunk.IdxCount * sizeof(ImDrawIdx));
+            memmove(draw_list_3d._ZWritePtr, z_reserved + chunk.PrimBegin * (renderer.IdxConsumed / 3), chunk.ZCount * sizeof(float));
+        }
+        draw_list_3d._VtxWritePtr += chunk.VtxCount;
+        draw_list_3d._IdxWritePtr += chunk.IdxCount;
+        draw_list_3d._ZWritePtr += chunk.ZCount;
+        draw_list_3d._VtxCurrentIdx += chunk.VtxCount;
+    }
+    return num_culled;
+}
+
+/// Returns the box outside of which primitives are culled
+static ImPlot3DBox GetCullBox(const ImPlot3DPlot& plot) {
     ImPlot3DBox cull_box;
     if (ImHasFlag(plot.Flags, ImPlot3DFlags_NoClip)) {
         cull_box.Min = ImPlot3DPoint(-HUGE_VAL, -HUGE_VAL, -HUGE_VAL);
@@ -1044,6 +2070,15 @@ template <template <class> class _Renderer, class _Getter, typename... Args> voi
         cull_box.Min = plot.RangeMin();
         cull_box.Max = plot.RangeMax();
     }
+    return cull_box;
+}
+
+/// Renders primitive shapes
+template <template <class> class _Renderer, class _Getter, typename... Args> void RenderPrimitives(const _Getter& getter, Args... args) {
+    _Renderer<_Getter> renderer(getter, args...);
+    ImPlot3DPlot& plot = *GetCurrentPlot();
+    ImDrawList3D& draw_list_3d = plot.DrawList;
+    const ImPlot3DBox cull_box = GetCullBox(plot);
 
     // Find how many can be reserved up to end of current draw command's limit
     unsigned int prims_to_render = ImMin(renderer.Prims, (ImDrawList3D::MaxIdx() - draw_list_3d._VtxCurrentIdx) / renderer.VtxConsumed);
@@ -1054,15 +2089,211 @@ template <template <class> class _Renderer, class _Getter, typename... Args> voi
     // Initialize renderer
     renderer.Init(draw_list_3d);
 
-    // Render primitives
+    // Render primitives, splitting large items into chunks rendered in parallel
     int num_culled = 0;
-    for (unsigned int i = 0; i < prims_to_render; i++)
-        if (!renderer.Render(draw_list_3d, cull_box, i))
-            num_culled++;
+    int job_count = _Renderer<_Getter>::Parallel ? ImMin(GetParallelJobCount(), (int)(prims_to_render / RENDER_PARALLEL_MIN_PRIMS)) : 1;
+    if (job_count > 1) {
+        num_culled = RenderPrimitivesParallel(renderer, draw_list_3d, cull_box, prims_to_render, job_count);
+    } else {
+        for (unsigned int i = 0; i < prims_to_render; i++)
+            if (!renderer.Render(draw_list_3d, cull_box, i))
+                num_culled++;
+    }
     // Unreserve unused vertices and indices
     draw_list_3d.PrimUnreserve(num_culled * renderer.IdxConsumed, num_culled * renderer.VtxConsumed);
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] Shading
+//-----------------------------------------------------------------------------
+
+// Direction towards the light in view space (x right, y up, z towards the viewer): above, left and in front of the plot
+static const ImPlot3DPoint SHADING_LIGHT_DIR(-0.3714f, 0.5571f, 0.7428f);
+// Shade of the faces perpendicular to the light
+static const float SHADING_AMBIENT = 0.35f;
+
+// Normalizes each normal in place, normals of degenerate or non-finite faces become zero
+static void NormalizeNormals(ImPlot3DPoint* normals, int count) {
+    for (int i = 0; i < count; i++) {
+        ImPlot3DPoint& n = normals[i];
+        const float len2 = n.x * n.x + n.y * n.y + n.z * n.z;
+        const float inv_len = len2 > 0.0f && len2 <= FLT_MAX ? 1.0f / ImSqrt(len2) : 0.0f;
+        n.x *= inv_len;
+        n.y *= inv_len;
+        n.z *= inv_len;
+    }
+}
+
+// Vertex normals of a triangle mesh, the sum of the normals of the triangles using each vertex weighted by their area
+static void ComputeMeshNormals(const ImPlot3DPoint* vtx, int vtx_count, const unsigned int* idx, int idx_count, ImVector<ImPlot3DPoint>& normals) {
+    normals.resize(vtx_count);
+    for (int i = 0; i < vtx_count; i++)
+        normals.Data[i] = ImPlot3DPoint(0.0f, 0.0f, 0.0f);
+    for (int i = 0; i + 2 < idx_count; i += 3) {
+        const ImPlot3DPoint& a = vtx[idx[i]];
+        const ImPlot3DPoint& b = vtx[idx[i + 1]];
+        const ImPlot3DPoint& c = vtx[idx[i + 2]];
+        const float ux = b.x - a.x, uy = b.y - a.y, uz = b.z - a.z;
+        const float vx = c.x - a.x, vy = c.y - a.y, vz = c.z - a.z;
+        const ImPlot3DPoint n(uy * vz - uz * vy, uz * vx - ux * vz, ux * vy - uy * vx);
+        if (!(n.x * n.x + n.y * n.y + n.z * n.z <= FLT_MAX))
+            continue; // Triangle with a NaN or infinite vertex
+        for (int k = 0; k < 3; k++) {
+            ImPlot3DPoint& vn = normals.Data[idx[i + k]];
+            vn.x += n.x;
+            vn.y += n.y;
+            vn.z += n.z;
+        }
+    }
+    NormalizeNormals(normals.Data, vtx_count);
+}
+
+// Vertex normals of a surface grid, from the central differences along the rows and columns of the grid
+template <typename _Getter> void ComputeSurfaceNormals(const _Getter& getter, int x_count, int y_count, ImVector<ImPlot3DPoint>& normals) {
+    normals.resize(x_count * y_count);
+    for (int y = 0; y < y_count; y++) {
+        for (int x = 0; x < x_count; x++) {
+            const ImPlot3DPoint dx = getter(ImMin(x + 1, x_count - 1) + y * x_count) - getter(ImMax(x - 1, 0) + y * x_count);
+            const ImPlot3DPoint dy = getter(x + ImMin(y + 1, y_count - 1) * x_count) - getter(x + ImMax(y - 1, 0) * x_count);
+            normals[x + y * x_count] = dx.Cross(dy);
+        }
+    }
+    NormalizeNormals(normals.Data, normals.Size);
+}
+
+// Returns the cached normals of the current item, setting update when they must be computed again (first use, unversioned or changed data).
+// Unversioned data is computed again every frame anyway, so its pointer, which may change every frame, is left out of the key
+static ImPlot3DNormals& GetItemNormals(const void* data, int count_a, int count_b, bool* update) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    const ImPlot3DNextItemData& n = gp.NextItemData;
+    const bool versioned = n.DataVersion != 0 || n.SourceVersion != 0;
+    const int counts[2] = {count_a, count_b};
+    ImGuiID key = ImHashData(&gp.CurrentPlot->ID, sizeof(ImGuiID));
+    key = ImHashData(&gp.CurrentItem->ID, sizeof(ImGuiID), key);
+    if (versioned)
+        key = ImHashData(&data, sizeof(data), key);
+    key = ImHashData(counts, sizeof(counts), key);
+    key = ImHashData(n.DataScale, sizeof(n.DataScale), key);
+    key = ImHashData(n.DataOffset, sizeof(n.DataOffset), key);
+    ImPlot3DNormals& normals = *gp.Normals.GetOrAddByKey(key);
+    *update = normals.LastFrame == -1 || !versioned || normals.DataVersion != n.DataVersion || normals.SourceVersion != n.SourceVersion;
+    normals.Key = key;
+    normals.DataVersion = n.DataVersion;
+    normals.SourceVersion = n.SourceVersion;
+    normals.LastFrame = ImGui::GetFrameCount();
+    return normals;
+}
+
+// Mesh whose vertex normals shade its fill. The normals are only computed once the item is known to be rendered (see GetMeshNormals())
+struct MeshShading {
+    MeshShading(const ImPlot3DPoint* vtx, int vtx_count, const unsigned int* idx, int idx_count)
+        : Vtx(vtx), VtxCount(vtx_count), Idx(idx), IdxCount(idx_count) {}
+    const ImPlot3DPoint* Vtx;
+    int VtxCount;
+    const unsigned int* Idx;
+    int IdxCount;
+};
+
+// Returns the vertex normals of a mesh, computed again only when the item data version changes. Called while the item is plotted
+static const ImPlot3DPoint* GetMeshNormals(const MeshShading& mesh) {
+    bool update;
+    ImPlot3DNormals& normals = GetItemNormals(mesh.Vtx, mesh.VtxCount, mesh.IdxCount, &update);
+    if (update)
+        ComputeMeshNormals(mesh.Vtx, mesh.VtxCount, mesh.Idx, mesh.IdxCount, normals.Normals);
+    return normals.Normals.Data;
+}
+
+// Returns the vertex normals of a surface, computed again only when the item data version changes. Called while the item is plotted
+template <typename _Getter> const ImPlot3DPoint* GetSurfaceNormals(const _Getter& getter, int x_count, int y_count) {
+    bool update;
+    ImPlot3DNormals& normals = GetItemNormals(GetGetterData(getter), x_count, y_count, &update);
+    if (update)
+        ComputeSurfaceNormals(getter, x_count, y_count, normals.Normals);
+    return normals.Normals.Data;
+}
+
+struct ShadeVerticesData {
+    const ImPlot3DPoint* Normals;
+    ImU32* Shades;
+    int Count;
+    int JobCount;
+    ImPlot3DPoint Light;  // Light direction in plot coordinates, scaled by the axes (see ShadeVertices())
+    ImPlot3DPoint Scale2; // Squared scale of the normal coordinates by the axes
+};
+
+static void ShadeVerticesJob(int index, void* job_data) {
+    const ShadeVerticesData& data = *(const ShadeVerticesData*)job_data;
+    const int begin = (int)((ImS64)data.Count * index / data.JobCount);
+    const int end = (int)((ImS64)data.Count * (index + 1) / data.JobCount);
+    const ImPlot3DPoint* normals = data.Normals;
+    ImU32* shades = data.Shades;
+    const float lx = data.Light.x, ly = data.Light.y, lz = data.Light.z;
+    const float sx = data.Scale2.x, sy = data.Scale2.y, sz = data.Scale2.z;
+    for (int i = begin; i < end; i++) {
+        const float nx = normals[i].x, ny = normals[i].y, nz = normals[i].z;
+        const float dot = ImAbs(nx * lx + ny * ly + nz * lz);
+        const float len2 = ImMax(nx * nx * sx + ny * ny * sy + nz * nz * sz, FLT_MIN);
+        const float diffuse = ImMin(dot / ImSqrt(len2), 1.0f);
+        shades[i] = (ImU32)((SHADING_AMBIENT + (1.0f - SHADING_AMBIENT) * diffuse) * 256.0f);
+    }
+}
+
+// Computes the Lambert shade of each vertex from its normal, in [0, 256] for ShadeColor(). Faces are lit from both sides. The buffer is
+// valid until the next item is plotted
+static const ImU32* ShadeVertices(const ImPlot3DPoint* normals, int count) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    const ImPlot3DPlot& plot = *gp.CurrentPlot;
+
+    // Normals are transformed to view space by the inverse transpose of the axes scale (range / box scale per axis) and the rotation. The
+    // light is rotated back instead, so each vertex only needs a scaled dot product
+    const ImPlot3DPoint range = plot.RangeMax() - plot.RangeMin();
+    ImPlot3DPoint scale;
+    float scale_max = 0.0f;
+    for (int i = 0; i < 3; i++) {
+        scale[i] = range[i] / plot.BoxScale[i];
+        if (ImHasFlag(plot.Axes[i].Flags, ImPlot3DAxisFlags_Invert))
+            scale[i] = -scale[i];
+        scale_max = ImMax(scale_max, ImAbs(scale[i]));
+    }
+    const ImPlot3DPoint light = plot.Rotation.Inverse() * SHADING_LIGHT_DIR;
+    ShadeVerticesData data;
+    for (int i = 0; i < 3; i++) {
+        scale[i] = scale_max > 0.0f ? scale[i] / scale_max : 1.0f;
+        data.Light[i] = scale[i] * light[i];
+        data.Scale2[i] = scale[i] * scale[i];
+    }
+
+    gp.TempShades.resize(count);
+    data.Normals = normals;
+    data.Shades = gp.TempShades.Data;
+    data.Count = count;
+    data.JobCount = ImClamp(count / (int)RENDER_PARALLEL_MIN_PRIMS, 1, GetParallelJobCount());
+    if (data.JobCount > 1)
+        ParallelFor(data.JobCount, ShadeVerticesJob, &data);
+    else
+        ShadeVerticesJob(0, &data);
+    return gp.TempShades.Data;
+}
+
+// Shade of the flat faces perpendicular to an axis (e.g. voxel faces), see ShadeVertices()
+static ImU32 ShadeAxis(ImAxis3D axis) {
+    const ImPlot3DPlot& plot = *GImPlot3D->CurrentPlot;
+    ImPlot3DPoint normal(0.0f, 0.0f, 0.0f);
+    normal[axis] = 1.0f;
+    const float diffuse = ImMin(ImAbs((plot.Rotation * normal).Dot(SHADING_LIGHT_DIR)), 1.0f);
+    return (ImU32)((SHADING_AMBIENT + (1.0f - SHADING_AMBIENT) * diffuse) * 256.0f);
+}
+
+void GarbageCollectNormals() {
+    ImPlot3DContext& gp = *GImPlot3D;
+    const int frame = ImGui::GetFrameCount();
+    for (int i = 0; i < gp.Normals.GetMapSize(); i++) {
+        ImPlot3DNormals* normals = gp.Normals.TryGetMapData(i);
+        if (normals != nullptr && frame - normals->LastFrame > IMPLOT3D_NORMALS_KEEP_FRAMES)
+            gp.Normals.Remove(normals->Key, normals);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Markers
 //-----------------------------------------------------------------------------
@@ -1152,12 +2383,34 @@ template <typename _Getter> void RenderMarkers(const _Getter& getter, ImPlot3DMa
     }
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] Colormap Sampling
+//-----------------------------------------------------------------------------
+
+template <typename T>
+void SampleColormapU32(const T* values, ImU32* out, int count, double scale_min, double scale_max, ImPlot3DColormap cmap) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    cmap = cmap == IMPLOT3D_AUTO ? gp.Style.Colormap : cmap;
+    IM_ASSERT_USER_ERROR(cmap >= 0 && cmap < gp.ColormapData.Count, "Invalid colormap index!");
+    const ImPlot3DColormapLUT lut(gp.ColormapData, cmap, scale_min, scale_max);
+    for (int i = 0; i < count; i++)
+        out[i] = lut((double)values[i]);
+}
+
+#define INSTANTIATE_MACRO(T)                                                                                                                         \
+    template IMPLOT3D_API void SampleColormapU32<T>(const T* values, ImU32* out, int count, double scale_min, double scale_max,                      \
+                                                    ImPlot3DColormap cmap);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotScatter
 //-----------------------------------------------------------------------------
 
-template <typename Getter> void PlotScatterEx(const char* label_id, const Getter& getter, ImPlot3DScatterFlags flags) {
-    if (BeginItemEx(label_id, getter, flags, ImPlot3DCol_MarkerOutline)) {
+template <typename Getter, typename Fitter>
+void PlotScatterEx(const char* label_id, const Getter& getter, const Fitter& fitter, ImPlot3DScatterFlags flags) {
+    if (BeginItemEx(label_id, fitter, flags, ImPlot3DCol_MarkerOutline)) {
+        PrepareColors(getter);
         const ImPlot3DNextItemData& n = GetItemData();
         ImPlot3DMarker marker = n.Marker == ImPlot3DMarker_None ? ImPlot3DMarker_Circle : n.Marker;
         const ImU32 col_line = ImGui::GetColorU32(n.Colors[ImPlot3DCol_MarkerOutline]);
@@ -1168,27 +2421,71 @@ template <typename Getter> void PlotScatterEx(const char* label_id, const Getter
     }
 }
 
+template <typename Getter> void PlotScatterEx(const char* label_id, const Getter& getter, ImPlot3DScatterFlags flags) {
+    PlotScatterEx(label_id, getter, getter, flags);
+}
+
+// Plots the points with faded colors when requested, fitting them without computing their colors
+template <typename _Getter, typename _Fitter>
+void PlotScatterFade(const char* label_id, const _Getter& getter, const _Fitter& fitter, ImPlot3DScatterFlags flags) {
+    if (ImHasFlag(flags, ImPlot3DScatterFlags_Fade))
+        PlotScatterEx(label_id, GetterColored<_Getter, ColorerFade>(getter, ColorerFade(getter.Count)), fitter, flags);
+    else
+        PlotScatterEx(label_id, getter, fitter, flags);
+}
+
 template <typename T>
 void PlotScatter(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DScatterFlags flags, int offset, int stride) {
     if (count < 1)
         return;
-    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, offset, stride), IndexerIdx<T>(ys, count, offset, stride),
-                                                                  IndexerIdx<T>(zs, count, offset, stride), count);
-    return PlotScatterEx(label_id, getter, flags);
+    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(NextItemIndexer(ImAxis3D_X, xs, count, offset, stride),
+                                                                  NextItemIndexer(ImAxis3D_Y, ys, count, offset, stride),
+                                                                  NextItemIndexer(ImAxis3D_Z, zs, count, offset, stride), count);
+    return PlotScatterFade(label_id, getter, getter, flags);
+}
+
+template <typename T>
+void PlotScatter(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count, double scale_min, double scale_max,
+                 ImPlot3DScatterFlags flags, int offset, int stride) {
+    if (count < 1)
+        return;
+    typedef GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> Getter;
+    Getter getter(NextItemIndexer(ImAxis3D_X, xs, count, offset, stride), NextItemIndexer(ImAxis3D_Y, ys, count, offset, stride),
+                  NextItemIndexer(ImAxis3D_Z, zs, count, offset, stride), count);
+    ColorerValues<IndexerIdx<T>> colorer(IndexerIdx<T>(values, count, offset, stride), count, scale_min, scale_max,
+                                         ImHasFlag(flags, ImPlot3DScatterFlags_Fade));
+    return PlotScatterEx(label_id, GetterColored<Getter, ColorerValues<IndexerIdx<T>>>(getter, colorer), getter, flags);
 }
 
 #define INSTANTIATE_MACRO(T)                                                                                                                         \
     template IMPLOT3D_API void PlotScatter<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DScatterFlags flags,    \
-                                              int offset, int stride);
+                                              int offset, int stride);                                                                               \
+    template IMPLOT3D_API void PlotScatter<T>(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count,               \
+                                              double scale_min, double scale_max, ImPlot3DScatterFlags flags, int offset, int stride);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
+void PlotScatter(const char* label_id, const ImPlot3DStream& stream, ImPlot3DScatterFlags flags) {
+    if (stream.Size() < 1)
+        return;
+    // The stream version identifies its points, a version set with SetNextItemDataVersion() is kept as well
+    GImPlot3D->NextItemData.SourceVersion = stream.Version;
+    PlotScatterFade(label_id, GetterStream(stream), FitterStream(stream), flags);
+}
+
+void PlotScatter(const char* label_id, ImPlot3DSPSCBuffer& buffer, ImPlot3DScatterFlags flags) {
+    buffer.Consume();
+    PlotScatter(label_id, buffer.History, flags);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotLine
 //-----------------------------------------------------------------------------
 
-template <typename _Getter> void PlotLineEx(const char* label_id, const _Getter& getter, ImPlot3DLineFlags flags) {
-    if (BeginItemEx(label_id, getter, flags, ImPlot3DCol_Line)) {
+template <typename _Getter, typename _Fitter>
+void PlotLineEx(const char* label_id, const _Getter& getter, const _Fitter& fitter, ImPlot3DLineFlags flags) {
+    if (BeginItemEx(label_id, fitter, flags, ImPlot3DCol_Line)) {
+        PrepareColors(getter);
         const ImPlot3DNextItemData& n = GetItemData();
         if (getter.Count >= 2 && n.RenderLine) {
             const ImU32 col_line = ImGui::GetColorU32(n.Colors[ImPlot3DCol_Line]);
@@ -1217,26 +2514,69 @@ template <typename _Getter> void PlotLineEx(const char* label_id, const _Getter&
     }
 }
 
+template <typename _Getter> void PlotLineEx(const char* label_id, const _Getter& getter, ImPlot3DLineFlags flags) {
+    PlotLineEx(label_id, getter, getter, flags);
+}
+
+// Plots the line with faded colors when requested, fitting it without computing its colors
+template <typename _Getter, typename _Fitter>
+void PlotLineFade(const char* label_id, const _Getter& getter, const _Fitter& fitter, ImPlot3DLineFlags flags) {
+    if (ImHasFlag(flags, ImPlot3DLineFlags_Fade))
+        PlotLineEx(label_id, GetterColored<_Getter, ColorerFade>(getter, ColorerFade(getter.Count)), fitter, flags);
+    else
+        PlotLineEx(label_id, getter, fitter, flags);
+}
+
 IMPLOT3D_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DLineFlags flags, int offset, int stride) {
     if (count < 2)
         return;
-    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, offset, stride), IndexerIdx<T>(ys, count, offset, stride),
-                                                                  IndexerIdx<T>(zs, count, offset, stride), count);
-    return PlotLineEx(label_id, getter, flags);
+    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(NextItemIndexer(ImAxis3D_X, xs, count, offset, stride),
+                                                                  NextItemIndexer(ImAxis3D_Y, ys, count, offset, stride),
+                                                                  NextItemIndexer(ImAxis3D_Z, zs, count, offset, stride), count);
+    return PlotLineFade(label_id, getter, getter, flags);
+}
+
+IMPLOT3D_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count, double scale_min,
+                           double scale_max, ImPlot3DLineFlags flags, int offset, int stride) {
+    if (count < 2)
+        return;
+    typedef GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> Getter;
+    Getter getter(NextItemIndexer(ImAxis3D_X, xs, count, offset, stride), NextItemIndexer(ImAxis3D_Y, ys, count, offset, stride),
+                  NextItemIndexer(ImAxis3D_Z, zs, count, offset, stride), count);
+    ColorerValues<IndexerIdx<T>> colorer(IndexerIdx<T>(values, count, offset, stride), count, scale_min, scale_max,
+                                         ImHasFlag(flags, ImPlot3DLineFlags_Fade));
+    return PlotLineEx(label_id, GetterColored<Getter, ColorerValues<IndexerIdx<T>>>(getter, colorer), getter, flags);
 }
 
 #define INSTANTIATE_MACRO(T)                                                                                                                         \
     template IMPLOT3D_API void PlotLine<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DLineFlags flags,          \
-                                           int offset, int stride);
+                                           int offset, int stride);                                                                                  \
+    template IMPLOT3D_API void PlotLine<T>(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count,                  \
+                                           double scale_min, double scale_max, ImPlot3DLineFlags flags, int offset, int stride);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
+void PlotLine(const char* label_id, const ImPlot3DStream& stream, ImPlot3DLineFlags flags) {
+    if (stream.Size() < 2)
+        return;
+    // The stream version identifies its points, a version set with SetNextItemDataVersion() is kept as well
+    GImPlot3D->NextItemData.SourceVersion = stream.Version;
+    PlotLineFade(label_id, GetterStream(stream), FitterStream(stream), flags);
+}
+
+void PlotLine(const char* label_id, ImPlot3DSPSCBuffer& buffer, ImPlot3DLineFlags flags) {
+    buffer.Consume();
+    PlotLine(label_id, buffer.History, flags);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotTriangle
 //-----------------------------------------------------------------------------
 
-template <typename _Getter> void PlotTriangleEx(const char* label_id, const _Getter& getter, ImPlot3DTriangleFlags flags) {
-    if (BeginItemEx(label_id, getter, flags, ImPlot3DCol_Fill)) {
+template <typename _Getter, typename _Fitter>
+void PlotTriangleEx(const char* label_id, const _Getter& getter, const _Fitter& fitter, ImPlot3DTriangleFlags flags) {
+    if (BeginItemEx(label_id, fitter, flags, ImPlot3DCol_Fill)) {
+        PrepareColors(getter);
         const ImPlot3DNextItemData& n = GetItemData();
 
         // Render fill
@@ -1266,14 +2606,28 @@ IMPLOT3D_TMP void PlotTriangle(const char* label_id, const T* xs, const T* ys, c
                                int stride) {
     if (count < 3)
         return;
-    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, offset, stride), IndexerIdx<T>(ys, count, offset, stride),
-                                                                  IndexerIdx<T>(zs, count, offset, stride), count);
-    return PlotTriangleEx(label_id, getter, flags);
+    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(NextItemIndexer(ImAxis3D_X, xs, count, offset, stride),
+                                                                  NextItemIndexer(ImAxis3D_Y, ys, count, offset, stride),
+                                                                  NextItemIndexer(ImAxis3D_Z, zs, count, offset, stride), count);
+    return PlotTriangleEx(label_id, getter, getter, flags);
+}
+
+IMPLOT3D_TMP void PlotTriangle(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count, double scale_min,
+                               double scale_max, ImPlot3DTriangleFlags flags, int offset, int stride) {
+    if (count < 3)
+        return;
+    typedef GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> Getter;
+    Getter getter(NextItemIndexer(ImAxis3D_X, xs, count, offset, stride), NextItemIndexer(ImAxis3D_Y, ys, count, offset, stride),
+                  NextItemIndexer(ImAxis3D_Z, zs, count, offset, stride), count);
+    ColorerValues<IndexerIdx<T>> colorer(IndexerIdx<T>(values, count, offset, stride), count, scale_min, scale_max, false);
+    return PlotTriangleEx(label_id, GetterColored<Getter, ColorerValues<IndexerIdx<T>>>(getter, colorer), getter, flags);
 }
 
 #define INSTANTIATE_MACRO(T)                                                                                                                         \
     template IMPLOT3D_API void PlotTriangle<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DTriangleFlags flags,  \
-                                               int offset, int stride);
+                                               int offset, int stride);                                                                              \
+    template IMPLOT3D_API void PlotTriangle<T>(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count,              \
+                                               double scale_min, double scale_max, ImPlot3DTriangleFlags flags, int offset, int stride);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
@@ -1281,8 +2635,10 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotQuad
 //-----------------------------------------------------------------------------
 
-template <typename _Getter> void PlotQuadEx(const char* label_id, const _Getter& getter, ImPlot3DQuadFlags flags) {
-    if (BeginItemEx(label_id, getter, flags, ImPlot3DCol_Fill)) {
+template <typename _Getter, typename _Fitter>
+void PlotQuadEx(const char* label_id, const _Getter& getter, const _Fitter& fitter, ImPlot3DQuadFlags flags) {
+    if (BeginItemEx(label_id, fitter, flags, ImPlot3DCol_Fill)) {
+        PrepareColors(getter);
         const ImPlot3DNextItemData& n = GetItemData();
 
         // Render fill
@@ -1311,14 +2667,28 @@ template <typename _Getter> void PlotQuadEx(const char* label_id, const _Getter&
 IMPLOT3D_TMP void PlotQuad(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DQuadFlags flags, int offset, int stride) {
     if (count < 3)
         return;
-    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, offset, stride), IndexerIdx<T>(ys, count, offset, stride),
-                                                                  IndexerIdx<T>(zs, count, offset, stride), count);
-    return PlotQuadEx(label_id, getter, flags);
+    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(NextItemIndexer(ImAxis3D_X, xs, count, offset, stride),
+                                                                  NextItemIndexer(ImAxis3D_Y, ys, count, offset, stride),
+                                                                  NextItemIndexer(ImAxis3D_Z, zs, count, offset, stride), count);
+    return PlotQuadEx(label_id, getter, getter, flags);
+}
+
+IMPLOT3D_TMP void PlotQuad(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count, double scale_min,
+                           double scale_max, ImPlot3DQuadFlags flags, int offset, int stride) {
+    if (count < 3)
+        return;
+    typedef GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> Getter;
+    Getter getter(NextItemIndexer(ImAxis3D_X, xs, count, offset, stride), NextItemIndexer(ImAxis3D_Y, ys, count, offset, stride),
+                  NextItemIndexer(ImAxis3D_Z, zs, count, offset, stride), count);
+    ColorerValues<IndexerIdx<T>> colorer(IndexerIdx<T>(values, count, offset, stride), count, scale_min, scale_max, false);
+    return PlotQuadEx(label_id, GetterColored<Getter, ColorerValues<IndexerIdx<T>>>(getter, colorer), getter, flags);
 }
 
 #define INSTANTIATE_MACRO(T)                                                                                                                         \
     template IMPLOT3D_API void PlotQuad<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DQuadFlags flags,          \
-                                           int offset, int stride);
+                                           int offset, int stride);                                                                                  \
+    template IMPLOT3D_API void PlotQuad<T>(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count,                  \
+                                           double scale_min, double scale_max, ImPlot3DQuadFlags flags, int offset, int stride);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
@@ -1326,15 +2696,42 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotSurface
 //-----------------------------------------------------------------------------
 
-template <typename _Getter> void PlotSurfaceEx(const char* label_id, const _Getter& getter, int x_count, int y_count, double scale_min,
-                                               double scale_max, ImPlot3DSurfaceFlags flags) {
-    if (BeginItemEx(label_id, getter, flags, ImPlot3DCol_Fill)) {
+// Plots a surface, colormapped by the values when has_values is set or when the fill color is automatic (the values are then the heights)
+template <typename _Getter, typename _Fitter, typename _Values>
+void PlotSurfaceEx(const char* label_id, const _Getter& getter, const _Fitter& fitter, const _Values& values, bool has_values, int x_count,
+                   int y_count, double scale_min, double scale_max, ImPlot3DSurfaceFlags flags) {
+    if (BeginItemEx(label_id, fitter, flags, ImPlot3DCol_Fill)) {
         const ImPlot3DNextItemData& n = GetItemData();
 
         // Render fill
         if (getter.Count >= 4 && n.RenderFill && !ImHasFlag(flags, ImPlot3DSurfaceFlags_NoFill)) {
             const ImU32 col_fill = ImGui::GetColorU32(n.Colors[ImPlot3DCol_Fill]);
-            RenderPrimitives<RendererSurfaceFill>(getter, x_count, y_count, col_fill, scale_min, scale_max);
+            const bool shaded = ImHasFlag(flags, ImPlot3DSurfaceFlags_Shaded);
+            if (has_values || n.IsAutoFill || shaded) {
+                // Each vertex is shared by up to four quads, so its color and shade are computed once
+                ImU32* colors = nullptr;
+                if (has_values || n.IsAutoFill) {
+                    ColorerValues<_Values> colorer(values, getter.Count, scale_min, scale_max, false);
+                    colorer.Prepare();
+                    colors = ComputePointColors(colorer, getter.Count, col_fill);
+                }
+                if (shaded) {
+                    const ImU32* shades = ShadeVertices(GetSurfaceNormals(getter, x_count, y_count), getter.Count);
+                    if (colors == nullptr) {
+                        GImPlot3D->TempColors.resize(getter.Count);
+                        colors = GImPlot3D->TempColors.Data;
+                        for (int i = 0; i < getter.Count; i++)
+                            colors[i] = ShadeColor(col_fill, shades[i]);
+                    } else {
+                        for (int i = 0; i < getter.Count; i++)
+                            colors[i] = ShadeColor(colors[i], shades[i]);
+                    }
+                }
+                GetterColored<_Getter, ColorerTable> getter_colored(getter, ColorerTable(colors));
+                RenderPrimitives<RendererSurfaceFill>(getter_colored, x_count, y_count, col_fill);
+            } else {
+                RenderPrimitives<RendererSurfaceFill>(getter, x_count, y_count, col_fill);
+            }
         }
 
         // Render lines
@@ -1354,19 +2751,54 @@ template <typename _Getter> void PlotSurfaceEx(const char* label_id, const _Gett
     }
 }
 
+template <typename _Getter, typename _Fitter>
+void PlotSurfaceEx(const char* label_id, const _Getter& getter, const _Fitter& fitter, int x_count, int y_count, double scale_min, double scale_max,
+                   ImPlot3DSurfaceFlags flags) {
+    PlotSurfaceEx(label_id, getter, fitter, IndexerGetterZ<_Getter>(getter), false, x_count, y_count, scale_min, scale_max, flags);
+}
+
 IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* xs, const T* ys, const T* zs, int x_count, int y_count, double scale_min,
                               double scale_max, ImPlot3DSurfaceFlags flags, int offset, int stride) {
     int count = x_count * y_count;
     if (count < 4)
         return;
-    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, offset, stride), IndexerIdx<T>(ys, count, offset, stride),
-                                                                  IndexerIdx<T>(zs, count, offset, stride), count);
-    return PlotSurfaceEx(label_id, getter, x_count, y_count, scale_min, scale_max, flags);
+    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(NextItemIndexer(ImAxis3D_X, xs, count, offset, stride),
+                                                                  NextItemIndexer(ImAxis3D_Y, ys, count, offset, stride),
+                                                                  NextItemIndexer(ImAxis3D_Z, zs, count, offset, stride), count);
+    return PlotSurfaceEx(label_id, getter, getter, x_count, y_count, scale_min, scale_max, flags);
+}
+
+IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* zs, int x_count, int y_count, double x_min, double x_max, double y_min, double y_max,
+                              double scale_min, double scale_max, ImPlot3DSurfaceFlags flags, int offset, int stride) {
+    int count = x_count * y_count;
+    if (count < 4)
+        return;
+    IndexerIdx<T> indexer_z = NextItemIndexer(ImAxis3D_Z, zs, count, offset, stride);
+    GetterGridZ<IndexerIdx<T>> getter(indexer_z, x_count, y_count, x_min, x_max, y_min, y_max);
+    FitterGridZ<IndexerIdx<T>> fitter(indexer_z, count, x_min, x_max, y_min, y_max);
+    return PlotSurfaceEx(label_id, getter, fitter, x_count, y_count, scale_min, scale_max, flags);
+}
+
+IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int x_count, int y_count,
+                              double scale_min, double scale_max, ImPlot3DSurfaceFlags flags, int offset, int stride) {
+    int count = x_count * y_count;
+    if (count < 4)
+        return;
+    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(NextItemIndexer(ImAxis3D_X, xs, count, offset, stride),
+                                                                  NextItemIndexer(ImAxis3D_Y, ys, count, offset, stride),
+                                                                  NextItemIndexer(ImAxis3D_Z, zs, count, offset, stride), count);
+    IndexerIdx<T> indexer_values(values, count, offset, stride);
+    return PlotSurfaceEx(label_id, getter, getter, indexer_values, true, x_count, y_count, scale_min, scale_max, flags);
 }
 
 #define INSTANTIATE_MACRO(T)                                                                                                                         \
     template IMPLOT3D_API void PlotSurface<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int x_count, int y_count,                 \
-                                              double scale_min, double scale_max, ImPlot3DSurfaceFlags flags, int offset, int stride);
+                                              double scale_min, double scale_max, ImPlot3DSurfaceFlags flags, int offset, int stride);               \
+    template IMPLOT3D_API void PlotSurface<T>(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int x_count,             \
+                                              int y_count, double scale_min, double scale_max, ImPlot3DSurfaceFlags flags, int offset, int stride);  \
+    template IMPLOT3D_API void PlotSurface<T>(const char* label_id, const T* zs, int x_count, int y_count, double x_min, double x_max,               \
+                                              double y_min, double y_max, double scale_min, double scale_max, ImPlot3DSurfaceFlags flags,            \
+                                              int offset, int stride);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
@@ -1374,22 +2806,258 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotMesh
 //-----------------------------------------------------------------------------
 
-void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count, ImPlot3DMeshFlags flags) {
-    Getter3DPoints getter(vtx, vtx_count);                     // Get vertices
-    GetterMeshTriangles getter_triangles(vtx, idx, idx_count); // Get triangle vertices
-    if (BeginItemEx(label_id, getter, flags, ImPlot3DCol_Fill)) {
+// Plots a mesh, whose fill is shaded by the vertex normals when given, or else by the normals of the shading mesh when given (see
+// GetMeshNormals())
+template <typename _Getter, typename _GetterTriangles, typename _Fitter>
+void PlotMeshEx(const char* label_id, const _Getter& getter, const _GetterTriangles& getter_triangles, const _Fitter& fitter,
+                ImPlot3DMeshFlags flags, const ImPlot3DPoint* normals = nullptr, const MeshShading* shading = nullptr) {
+    if (BeginItemEx(label_id, fitter, flags, ImPlot3DCol_Fill)) {
+        PrepareColors(getter_triangles);
         const ImPlot3DNextItemData& n = GetItemData();
 
         // Render fill
         if (getter.Count >= 3 && n.RenderFill && !ImHasFlag(flags, ImPlot3DMeshFlags_NoFill)) {
             const ImU32 col_fill = ImGui::GetColorU32(n.Colors[ImPlot3DCol_Fill]);
-            RenderPrimitives<RendererTriangleFill>(getter_triangles, col_fill);
+            if (normals == nullptr && shading != nullptr)
+                normals = GetMeshNormals(*shading);
+            if (normals != nullptr) {
+                // Each vertex is shared by several triangles, so its shade is computed once
+                ColorerShaded<_GetterTriangles> colorer(getter_triangles, ShadeVertices(normals, getter.Count), GetCornerIndices(getter_triangles));
+                GetterColored<_GetterTriangles, ColorerShaded<_GetterTriangles>> getter_shaded(getter_triangles, colorer);
+                RenderPrimitives<RendererTriangleFill>(getter_shaded, col_fill);
+            } else {
+                RenderPrimitives<RendererTriangleFill>(getter_triangles, col_fill);
+            }
         }
 
         // Render lines
         if (getter.Count >= 2 && n.RenderLine && !n.IsAutoLine && !ImHasFlag(flags, ImPlot3DMeshFlags_NoLines)) {
             const ImU32 col_line = ImGui::GetColorU32(n.Colors[ImPlot3DCol_Line]);
-            RenderPrimitives<RendererLineSegments>(GetterTriangleLines<GetterMeshTriangles>(getter_triangles), col_line, n.LineWeight);
+            RenderPrimitives<RendererLineSegments>(GetterTriangleLines<_GetterTriangles>(getter_triangles), col_line, n.LineWeight);
+        }
+
+        // Render markers
+        if (n.Marker != ImPlot3DMarker_None && !ImHasFlag(flags, ImPlot3DMeshFlags_NoMarkers)) {
+            const ImU32 col_line = ImGui::GetColorU32(n.Colors[ImPlot3DCol_MarkerOutline]);
+            const ImU32 col_fill = ImGui::GetColorU32(n.Colors[ImPlot3DCol_MarkerFill]);
+            RenderMarkers(getter, n.Marker, n.MarkerSize, n.RenderMarkerFill, col_fill, n.RenderMarkerLine, col_line, n.MarkerWeight);
+        }
+
+        EndItem();
+    }
+}
+
+void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count, ImPlot3DMeshFlags flags) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotMesh() needs to be called between BeginPlot() and EndPlot()!");
+
+    // The normals of the full mesh also shade its simplified levels, which keep the same vertices
+    const MeshShading shading(vtx, vtx_count, idx, idx_count);
+    const bool shaded = ImHasFlag(flags, ImPlot3DMeshFlags_Shaded);
+
+    // Render large meshes with the simplified level matching their size in pixels
+    if (ImHasFlag(flags, ImPlot3DMeshFlags_LOD) && idx_count / 3 > IMPLOT3D_MESH_LOD_MIN_TRIANGLES) {
+        const ImPlot3DMeshLOD* lod = GetMeshLOD(vtx, vtx_count, idx, idx_count);
+        const int level = SelectMeshLODLevel(*lod, idx_count, gp.NextItemData.TriangleBudget);
+        if (level != -1) {
+            idx = lod->Indices.Data + lod->Levels[level].IdxOffset;
+            idx_count = lod->Levels[level].IdxCount;
+        }
+    }
+
+    Getter3DPoints getter(vtx, vtx_count);                     // Get vertices
+    GetterMeshTriangles getter_triangles(vtx, idx, idx_count); // Get triangle vertices
+    PlotMeshEx(label_id, getter, getter_triangles, getter, flags, nullptr, shaded ? &shading : nullptr);
+}
+
+// Plots a mesh whose triangle corners take the colors of their vertices, given as colors or else as values mapped to the current colormap
+static void PlotMeshColored(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count,
+                            const ImU32* colors, const float* values, double scale_min, double scale_max, ImPlot3DMeshFlags flags) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    const MeshShading shading(vtx, vtx_count, idx, idx_count);
+    const MeshShading* shading_ptr = ImHasFlag(flags, ImPlot3DMeshFlags_Shaded) ? &shading : nullptr;
+    if (ImHasFlag(flags, ImPlot3DMeshFlags_LOD) && idx_count / 3 > IMPLOT3D_MESH_LOD_MIN_TRIANGLES) {
+        const ImPlot3DMeshLOD* lod = GetMeshLOD(vtx, vtx_count, idx, idx_count);
+        const int level = SelectMeshLODLevel(*lod, idx_count, gp.NextItemData.TriangleBudget);
+        if (level != -1) {
+            idx = lod->Indices.Data + lod->Levels[level].IdxOffset;
+            idx_count = lod->Levels[level].IdxCount;
+        }
+    }
+
+    Getter3DPoints getter(vtx, vtx_count);
+    GetterMeshTriangles triangles(vtx, idx, idx_count);
+    if (colors != nullptr) {
+        GetterColored<GetterMeshTriangles, ColorerIndexed> getter_triangles(triangles, ColorerIndexed(colors, idx));
+        PlotMeshEx(label_id, getter, getter_triangles, getter, flags, nullptr, shading_ptr);
+    } else {
+        ColorerIndexedValues colorer(values, vtx_count, scale_min, scale_max, idx);
+        GetterColored<GetterMeshTriangles, ColorerIndexedValues> getter_triangles(triangles, colorer);
+        PlotMeshEx(label_id, getter, getter_triangles, getter, flags, nullptr, shading_ptr);
+    }
+}
+
+void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count, const ImU32* colors,
+              ImPlot3DMeshFlags flags) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotMesh() needs to be called between BeginPlot() and EndPlot()!");
+    PlotMeshColored(label_id, vtx, idx, vtx_count, idx_count, colors, nullptr, 0.0, 0.0, flags);
+}
+
+void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count, const float* values,
+              double scale_min, double scale_max, ImPlot3DMeshFlags flags) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotMesh() needs to be called between BeginPlot() and EndPlot()!");
+    PlotMeshColored(label_id, vtx, idx, vtx_count, idx_count, nullptr, values, scale_min, scale_max, flags);
+}
+
+// Sets the vertices of a mesh and everything derived from their positions
+static void SetMeshVertices(ImPlot3DMesh& mesh, const ImPlot3DPoint* vtx) {
+    if (mesh.WeldSources.Size > 0) {
+        for (int i = 0; i < mesh.Vertices.Size; i++)
+            mesh.Vertices[i] = vtx[mesh.WeldSources[i]];
+    } else {
+        memcpy(mesh.Vertices.Data, vtx, mesh.Vertices.size_in_bytes());
+    }
+    mesh.Bounds = ImEmptyBox();
+    for (const ImPlot3DPoint& p : mesh.Vertices)
+        ImExpandBox(mesh.Bounds, p);
+    mesh.LOD.BoundsMin = mesh.Bounds.Min;
+    mesh.LOD.BoundsMax = mesh.Bounds.Max;
+    mesh.Version = NewSourceVersion();
+}
+
+ImPlot3DMeshHandle CreateMesh(const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count, ImPlot3DCreateMeshFlags flags) {
+    IM_ASSERT_USER_ERROR(GImPlot3D != nullptr, "No current context. Did you call ImPlot3D::CreateContext() or ImPlot3D::SetCurrentContext()?");
+    IM_ASSERT_USER_ERROR(vtx_count >= 0 && idx_count >= 0 && idx_count % 3 == 0, "idx_count must be a multiple of 3!");
+    ImPlot3DContext& gp = *GImPlot3D;
+    ImPlot3DMeshHandle handle;
+    handle.ID = ++gp.LastMeshID;
+    ImPlot3DMesh& mesh = *gp.Meshes.GetOrAddByKey(handle.ID);
+    mesh.ID = handle.ID;
+    mesh.SourceVtxCount = vtx_count;
+    mesh.Indices.resize(idx_count);
+    if (ImHasFlag(flags, ImPlot3DCreateMeshFlags_Weld)) {
+        // Each unique vertex is read from its first occurrence when the vertices are updated
+        ImVector<unsigned int> remap;
+        remap.resize(vtx_count);
+        const int unique_count = CalcWeldRemap(vtx, vtx_count, 0.0f, remap.Data);
+        mesh.Vertices.resize(unique_count);
+        mesh.WeldSources.resize(unique_count);
+        for (int i = vtx_count - 1; i >= 0; i--)
+            mesh.WeldSources[remap[i]] = (unsigned int)i;
+        for (int i = 0; i < idx_count; i++)
+            mesh.Indices[i] = remap[idx[i]];
+    } else {
+        mesh.Vertices.resize(vtx_count);
+        memcpy(mesh.Indices.Data, idx, mesh.Indices.size_in_bytes());
+    }
+    SetMeshVertices(mesh, vtx);
+    BuildMeshTopology(mesh);
+    return handle;
+}
+
+void UpdateMeshVertices(ImPlot3DMeshHandle handle, const ImPlot3DPoint* vtx, int vtx_count) {
+    IM_ASSERT_USER_ERROR(GImPlot3D != nullptr, "No current context. Did you call ImPlot3D::CreateContext() or ImPlot3D::SetCurrentContext()?");
+    ImPlot3DMesh* mesh = GetMesh(handle);
+    IM_ASSERT_USER_ERROR(mesh != nullptr, "Invalid mesh handle. Was the mesh destroyed?");
+    IM_ASSERT_USER_ERROR(vtx_count == mesh->SourceVtxCount, "vtx_count must be the vtx_count given to CreateMesh()!");
+    SetMeshVertices(*mesh, vtx);
+}
+
+void DestroyMesh(ImPlot3DMeshHandle handle) {
+    IM_ASSERT_USER_ERROR(GImPlot3D != nullptr, "No current context. Did you call ImPlot3D::CreateContext() or ImPlot3D::SetCurrentContext()?");
+    ImPlot3DContext& gp = *GImPlot3D;
+    ImPlot3DMesh* mesh = GetMesh(handle);
+    if (mesh != nullptr)
+        gp.Meshes.Remove(handle.ID, mesh);
+}
+
+struct ProjectMeshData {
+    ImPlot3DMesh* Mesh;
+    const ImPlot3DPlot* Plot;
+    ImPlot3DBox CullBox;
+    int JobCount;
+};
+
+static void ProjectMeshJob(int index, void* job_data) {
+    const ProjectMeshData& data = *(const ProjectMeshData*)job_data;
+    ImPlot3DMesh& mesh = *data.Mesh;
+    const int begin = (int)((ImS64)mesh.Vertices.Size * index / data.JobCount);
+    const int end = (int)((ImS64)mesh.Vertices.Size * (index + 1) / data.JobCount);
+    for (int i = begin; i < end; i++) {
+        const ImPlot3DPoint& p = mesh.Vertices.Data[i];
+        mesh.ProjectedPixels.Data[i] = PlotToPixels(*data.Plot, p);
+        mesh.ProjectedDepths.Data[i] = GetPointDepth(*data.Plot, p);
+        mesh.ProjectedInside.Data[i] = data.CullBox.Contains(p);
+    }
+}
+
+// Projects every vertex of a mesh once, instead of once per triangle and edge using it
+static void ProjectMeshVertices(ImPlot3DMesh& mesh) {
+    const ImPlot3DPlot& plot = *GetCurrentPlot();
+    mesh.ProjectedPixels.resize(mesh.Vertices.Size);
+    mesh.ProjectedDepths.resize(mesh.Vertices.Size);
+    mesh.ProjectedInside.resize(mesh.Vertices.Size);
+    ProjectMeshData data = {&mesh, &plot, GetCullBox(plot), 1};
+    data.JobCount = ImClamp(mesh.Vertices.Size / (int)RENDER_PARALLEL_MIN_PRIMS, 1, GetParallelJobCount());
+    if (data.JobCount > 1)
+        ParallelFor(data.JobCount, ProjectMeshJob, &data);
+    else
+        ProjectMeshJob(0, &data);
+}
+
+void PlotMesh(const char* label_id, ImPlot3DMeshHandle handle, ImPlot3DMeshFlags flags) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotMesh() needs to be called between BeginPlot() and EndPlot()!");
+    ImPlot3DMesh* mesh = GetMesh(handle);
+    IM_ASSERT_USER_ERROR(mesh != nullptr, "Invalid mesh handle. Was the mesh destroyed?");
+
+    // The mesh owns its vertices, so its version identifies them (versions are unique across meshes). A user data version is kept as well
+    gp.NextItemData.SourceVersion = mesh->Version;
+    Getter3DPoints getter(mesh->Vertices.Data, mesh->Vertices.Size);
+    FitterBox fitter(mesh->Bounds);
+
+    // The normals are computed again only when the vertices change
+    const bool shaded = ImHasFlag(flags, ImPlot3DMeshFlags_Shaded);
+    if (shaded && (mesh->Normals.Size != mesh->Vertices.Size || mesh->NormalsVersion != mesh->Version)) {
+        ComputeMeshNormals(mesh->Vertices.Data, mesh->Vertices.Size, mesh->Indices.Data, mesh->Indices.Size, mesh->Normals);
+        mesh->NormalsVersion = mesh->Version;
+    }
+    const ImPlot3DPoint* normals = shaded ? mesh->Normals.Data : nullptr;
+
+    // Render large meshes with the simplified level matching their size in pixels, through the path of unregistered meshes
+    if (ImHasFlag(flags, ImPlot3DMeshFlags_LOD) && mesh->Indices.Size / 3 > IMPLOT3D_MESH_LOD_MIN_TRIANGLES) {
+        if (mesh->LOD.LastFrame == -1)
+            BuildMeshLOD(mesh->LOD, mesh->Vertices.Data, mesh->Vertices.Size, mesh->Indices.Data, mesh->Indices.Size);
+        mesh->LOD.LastFrame = ImGui::GetFrameCount();
+        const int level = SelectMeshLODLevel(mesh->LOD, mesh->Indices.Size, gp.NextItemData.TriangleBudget);
+        if (level != -1) {
+            const ImPlot3DMeshLOD::Level& lod_level = mesh->LOD.Levels[level];
+            GetterMeshTriangles getter_triangles(mesh->Vertices.Data, mesh->LOD.Indices.Data + lod_level.IdxOffset, lod_level.IdxCount);
+            PlotMeshEx(label_id, getter, getter_triangles, fitter, flags, normals);
+            return;
+        }
+    }
+
+    if (BeginItemEx(label_id, fitter, flags, ImPlot3DCol_Fill)) {
+        const ImPlot3DNextItemData& n = GetItemData();
+        const bool render_fill = mesh->Indices.Size >= 3 && n.RenderFill && !ImHasFlag(flags, ImPlot3DMeshFlags_NoFill);
+        const bool render_lines = mesh->Edges.Size >= 2 && n.RenderLine && !n.IsAutoLine && !ImHasFlag(flags, ImPlot3DMeshFlags_NoLines);
+        if (render_fill || render_lines)
+            ProjectMeshVertices(*mesh);
+
+        // Render fill
+        if (render_fill) {
+            const ImU32 col_fill = ImGui::GetColorU32(n.Colors[ImPlot3DCol_Fill]);
+            const ImU32* shades = normals != nullptr ? ShadeVertices(normals, mesh->Vertices.Size) : nullptr;
+            RenderPrimitives<RendererMeshFill>(GetterMeshProjected(*mesh, mesh->Indices.Data, mesh->Indices.Size), col_fill, shades);
+        }
+
+        // Render each unique edge once
+        if (render_lines) {
+            const ImU32 col_line = ImGui::GetColorU32(n.Colors[ImPlot3DCol_Line]);
+            RenderPrimitives<RendererMeshEdges>(GetterMeshProjected(*mesh, mesh->Edges.Data, mesh->Edges.Size), col_line, n.LineWeight);
         }
 
         // Render markers
@@ -1403,6 +3071,573 @@ void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int
     }
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] PlotIsosurface
+//-----------------------------------------------------------------------------
+
+// Cube edges between corners numbered as in Paul Bourke's "Polygonising a scalar field": corners 0-3 are (0,0,0), (1,0,0), (1,1,0), (0,1,0)
+// and corners 4-7 the same at z = 1
+static const int MC_EDGES[12][2] = {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {4, 5}, {5, 6}, {6, 7}, {7, 4}, {0, 4}, {1, 5}, {2, 6}, {3, 7}};
+// Corners of each cube face, counter-clockwise seen from outside of the cube
+static const int MC_FACES[6][4] = {{0, 3, 2, 1}, {4, 5, 6, 7}, {0, 1, 5, 4}, {3, 7, 6, 2}, {0, 4, 7, 3}, {1, 2, 6, 5}};
+
+// Marching cubes triangles of the 256 cases of corners below the iso value. The table is built from the cube faces: on each face the crossed
+// edges are joined so that they separate the corners below the iso value, then the segments are chained into loops triangulated as fans.
+// Neighboring cells make the same choice on their shared face, so the surface has no cracks
+struct MarchingCubesTable {
+    ImS8 Edges[256][31]; // Crossed edges of the triangles of each case, terminated by -1
+    ImU8 TriCount[256];  // Number of triangles of each case
+
+    MarchingCubesTable() {
+        for (int c = 0; c < 256; c++) {
+            // Segment across each face, from the edge leaving a run of corners below the iso value to the edge entering it
+            int next[12];
+            for (int e = 0; e < 12; e++)
+                next[e] = -1;
+            for (const int* face : MC_FACES) {
+                for (int k = 0; k < 4; k++) {
+                    if (!((c >> face[k]) & 1) || ((c >> face[(k + 3) % 4]) & 1))
+                        continue;
+                    int last = k;
+                    while ((c >> face[(last + 1) % 4]) & 1)
+                        last = (last + 1) % 4;
+                    next[FindEdge(face[last], face[(last + 1) % 4])] = FindEdge(face[(k + 3) % 4], face[k]);
+                }
+            }
+            // Chain the segments into loops
+            int count = 0;
+            bool visited[12] = {};
+            for (int e = 0; e < 12; e++) {
+                if (next[e] == -1 || visited[e])
+                    continue;
+                int loop[12];
+                int loop_size = 0;
+                for (int l = e; !visited[l]; l = next[l]) {
+                    visited[l] = true;
+                    loop[loop_size++] = l;
+                }
+                for (int i = 1; i + 1 < loop_size; i++) {
+                    Edges[c][count++] = (ImS8)loop[0];
+                    Edges[c][count++] = (ImS8)loop[i];
+                    Edges[c][count++] = (ImS8)loop[i + 1];
+                }
+            }
+            Edges[c][count] = -1;
+            TriCount[c] = (ImU8)(count / 3);
+        }
+    }
+
+    static int FindEdge(int a, int b) {
+        for (int e = 0; e < 12; e++)
+            if ((MC_EDGES[e][0] == a && MC_EDGES[e][1] == b) || (MC_EDGES[e][0] == b && MC_EDGES[e][1] == a))
+                return e;
+        return -1;
+    }
+};
+
+static const MarchingCubesTable& GetMarchingCubesTable() {
+    static const MarchingCubesTable table;
+    return table;
+}
+
+// Cell layers extracted by one job of ExtractIsosurface()
+struct IsosurfaceSlab {
+    int Z0;                   // First cell layer
+    int Z1;                   // One past the last cell layer
+    unsigned int VtxCount;    // Number of vertices, counted by the first pass
+    unsigned int IdxCount;    // Number of indices, counted by the first pass
+    unsigned int VtxOffset;   // Offset of the slab vertices in the isosurface
+    unsigned int IdxOffset;   // Offset of the slab indices in the isosurface
+    unsigned int* EdgeVtx[5]; // Vertex on each x/y edge of the two current planes and on each z edge between them (~0u if not crossed)
+    ImU8* Below[2];           // Whether each sample of the two current planes is below the iso value
+};
+
+template <typename T> struct IsosurfaceJobData {
+    const T* Volume;
+    int NX, NY, NZ;
+    double Iso;           // Compared in double, so double and 64-bit integer volumes are not rounded to float
+    ImPlot3DPoint Origin; // Position of the first sample
+    ImPlot3DPoint Step;   // Distance between samples
+    IsosurfaceSlab* Slabs;
+    ImPlot3DPoint* Vtx; // Output vertices, nullptr in the counting pass
+    unsigned int* Idx;  // Output indices, nullptr in the counting pass
+};
+
+// Extracts the triangles of a slab. The first pass only counts them, so the second pass writes the slabs in place without allocating
+template <typename T> void ExtractIsosurfaceJob(int index, void* job_data) {
+    const IsosurfaceJobData<T>& d = *(const IsosurfaceJobData<T>*)job_data;
+    IsosurfaceSlab& slab = d.Slabs[index];
+    const MarchingCubesTable& table = GetMarchingCubesTable();
+    const int nx = d.NX;
+    const int ny = d.NY;
+    const size_t plane = (size_t)nx * ny;
+    const bool write = d.Vtx != nullptr;
+    unsigned int vtx_count = 0;
+    unsigned int idx_count = 0;
+
+    // Adds the vertex where the edge from sample (i, j, k) along axis crosses the iso value
+    auto add_vertex = [&](int i, int j, int k, int axis, double va, double vb) -> unsigned int {
+        if (write) {
+            ImPlot3DPoint p((float)i, (float)j, (float)k);
+            p[axis] += (float)((d.Iso - va) / (vb - va));
+            d.Vtx[slab.VtxOffset + vtx_count] = d.Origin + p * d.Step;
+        }
+        return slab.VtxOffset + vtx_count++;
+    };
+    auto sample = [&](int i, int j, int k) -> double { return (double)d.Volume[(size_t)k * plane + (size_t)j * nx + i]; };
+    // Classifies the samples of plane k, then adds the vertices of its crossed x and y edges. Samples are only read again on crossed edges
+    auto fill_plane = [&](int k) {
+        ImU8* below = slab.Below[k & 1];
+        const T* values = d.Volume + (size_t)k * plane;
+        for (size_t o = 0; o < plane; o++)
+            below[o] = (double)values[o] < d.Iso;
+        unsigned int* x_edges = slab.EdgeVtx[k & 1];
+        unsigned int* y_edges = slab.EdgeVtx[2 + (k & 1)];
+        for (int j = 0; j < ny; j++) {
+            for (int i = 0; i < nx; i++) {
+                const int o = j * nx + i;
+                if (i + 1 < nx)
+                    x_edges[o] = below[o] != below[o + 1] ? add_vertex(i, j, k, 0, sample(i, j, k), sample(i + 1, j, k)) : ~0u;
+                if (j + 1 < ny)
+                    y_edges[o] = below[o] != below[o + nx] ? add_vertex(i, j, k, 1, sample(i, j, k), sample(i, j + 1, k)) : ~0u;
+            }
+        }
+    };
+
+    fill_plane(slab.Z0);
+    for (int k = slab.Z0; k < slab.Z1; k++) {
+        fill_plane(k + 1);
+        const ImU8* b0 = slab.Below[k & 1];
+        const ImU8* b1 = slab.Below[(k + 1) & 1];
+        unsigned int* z_edges = slab.EdgeVtx[4];
+        for (int j = 0; j < ny; j++) {
+            for (int i = 0; i < nx; i++) {
+                const int o = j * nx + i;
+                z_edges[o] = b0[o] != b1[o] ? add_vertex(i, j, k, 2, sample(i, j, k), sample(i, j, k + 1)) : ~0u;
+            }
+        }
+
+        // Triangles of each cell, from the vertices of its crossed edges
+        const unsigned int* x0 = slab.EdgeVtx[k & 1];
+        const unsigned int* x1 = slab.EdgeVtx[(k + 1) & 1];
+        const unsigned int* y0 = slab.EdgeVtx[2 + (k & 1)];
+        const unsigned int* y1 = slab.EdgeVtx[2 + ((k + 1) & 1)];
+        for (int j = 0; j + 1 < ny; j++) {
+            for (int i = 0; i + 1 < nx; i++) {
+                const int o = j * nx + i;
+                const int cube = b0[o] | b0[o + 1] << 1 | b0[o + nx + 1] << 2 | b0[o + nx] << 3 | b1[o] << 4 | b1[o + 1] << 5 |
+                                 b1[o + nx + 1] << 6 | b1[o + nx] << 7;
+                if (!write) {
+                    idx_count += table.TriCount[cube] * 3;
+                    continue;
+                }
+                const unsigned int edge_vtx[12] = {x0[o],      y0[o + 1],      x0[o + nx],          y0[o],
+                                                   x1[o],      y1[o + 1],      x1[o + nx],          y1[o],
+                                                   z_edges[o], z_edges[o + 1], z_edges[o + nx + 1], z_edges[o + nx]};
+                for (const ImS8* e = table.Edges[cube]; *e != -1; e++)
+                    d.Idx[slab.IdxOffset + idx_count++] = edge_vtx[*e];
+            }
+        }
+    }
+    slab.VtxCount = vtx_count;
+    if (!write)
+        slab.IdxCount = idx_count;
+}
+
+// Extracts the isosurface of a volume with marching cubes, splitting the volume in slabs of cell layers extracted in parallel. Vertices on
+// the plane between two slabs are extracted by both
+template <typename T>
+void ExtractIsosurface(ImPlot3DIsosurface& surface, const T* volume, int nx, int ny, int nz, double iso, const ImPlot3DBox& bounds) {
+    // Each job needs five planes of edge vertices and two planes of classified samples. More jobs are only used while their planes fit in
+    // 64 MB, a single job is always run whatever the size of its planes
+    const ImS64 plane = (ImS64)nx * ny;
+    const ImS64 plane_size = plane * (5 * sizeof(unsigned int) + 2);
+    const ImS64 cell_count = (ImS64)(nx - 1) * (ny - 1) * (nz - 1);
+    const ImS64 max_jobs = ImMin((ImS64)ImMin(GetParallelJobCount(), nz - 1), (ImS64)(64 << 20) / plane_size);
+    const int job_count = (int)ImMax(ImMin(cell_count / IMPLOT3D_ISOSURFACE_MIN_JOB_CELLS, max_jobs), (ImS64)1);
+    IsosurfaceSlab slabs[IMPLOT3D_MAX_JOBS];
+    ImVector<unsigned int> edge_vtx;
+    ImVector<ImU8> below;
+    edge_vtx.resize((int)(job_count * plane * 5));
+    below.resize((int)(job_count * plane * 2));
+    for (int i = 0; i < job_count; i++) {
+        slabs[i].Z0 = (nz - 1) * i / job_count;
+        slabs[i].Z1 = (nz - 1) * (i + 1) / job_count;
+        slabs[i].VtxOffset = slabs[i].IdxOffset = 0;
+        for (int e = 0; e < 5; e++)
+            slabs[i].EdgeVtx[e] = edge_vtx.Data + (i * 5 + e) * plane;
+        for (int b = 0; b < 2; b++)
+            slabs[i].Below[b] = below.Data + (i * 2 + b) * plane;
+    }
+    IsosurfaceJobData<T> data;
+    data.Volume = volume;
+    data.NX = nx;
+    data.NY = ny;
+    data.NZ = nz;
+    data.Iso = iso;
+    data.Origin = bounds.Min;
+    data.Step = (bounds.Max - bounds.Min) / ImPlot3DPoint((float)(nx - 1), (float)(ny - 1), (float)(nz - 1));
+    data.Slabs = slabs;
+    data.Vtx = nullptr;
+    data.Idx = nullptr;
+
+    // Count the vertices and indices of each slab, then write them in place
+    ParallelFor(job_count, ExtractIsosurfaceJob<T>, &data);
+    unsigned int vtx_total = 0, idx_total = 0;
+    for (int i = 0; i < job_count; i++) {
+        slabs[i].VtxOffset = vtx_total;
+        slabs[i].IdxOffset = idx_total;
+        vtx_total += slabs[i].VtxCount;
+        idx_total += slabs[i].IdxCount;
+    }
+    surface.Vertices.resize((int)vtx_total);
+    surface.Indices.resize((int)idx_total);
+    data.Vtx = surface.Vertices.Data;
+    data.Idx = surface.Indices.Data;
+    if (vtx_total > 0)
+        ParallelFor(job_count, ExtractIsosurfaceJob<T>, &data);
+}
+
+IMPLOT3D_TMP void PlotIsosurface(const char* label_id, const T* volume, int nx, int ny, int nz, double iso, const ImPlot3DBox& bounds,
+                                 ImPlot3DIsosurfaceFlags flags) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotIsosurface() needs to be called between BeginPlot() and EndPlot()!");
+    if (nx < 2 || ny < 2 || nz < 2)
+        return;
+
+    // Each item keeps its own triangles, so changing the iso value of an item only extracts that item again
+    const ImPlot3DNextItemData& n = gp.NextItemData;
+    const ImGuiID item_id = n.Handle.ID != 0 ? n.Handle.ID : gp.CurrentItems->GetItemID(label_id);
+    const int size[3] = {nx, ny, nz};
+    ImGuiID key = ImHashData(&gp.CurrentPlot->ID, sizeof(ImGuiID));
+    key = ImHashData(&item_id, sizeof(ImGuiID), key);
+    key = ImHashData(&volume, sizeof(volume), key);
+    key = ImHashData(size, sizeof(size), key);
+    ImPlot3DIsosurface& surface = *gp.Isosurfaces.GetOrAddByKey(key);
+    const bool bounds_changed = !(surface.Bounds.Min == bounds.Min && surface.Bounds.Max == bounds.Max);
+    if (surface.LastFrame == -1 || surface.DataVersion != n.DataVersion || surface.Iso != iso || bounds_changed) {
+        surface.Key = key;
+        surface.DataVersion = n.DataVersion;
+        surface.Iso = iso;
+        surface.Bounds = bounds;
+        surface.Version = NewSourceVersion();
+        ExtractIsosurface(surface, volume, nx, ny, nz, iso, bounds);
+    }
+    surface.LastFrame = ImGui::GetFrameCount();
+
+    // Render through the indexed mesh path. The triangles identify the volume, iso value and bounds
+    gp.NextItemData.SourceVersion = surface.Version;
+    const MeshShading shading(surface.Vertices.Data, surface.Vertices.Size, surface.Indices.Data, surface.Indices.Size);
+    const bool shaded = ImHasFlag(flags, ImPlot3DIsosurfaceFlags_Shaded);
+    flags &= ~ImPlot3DIsosurfaceFlags_Shaded; // Same bit as ImPlot3DMeshFlags_LOD
+    Getter3DPoints getter(surface.Vertices.Data, surface.Vertices.Size);
+    GetterMeshTriangles getter_triangles(surface.Vertices.Data, surface.Indices.Data, surface.Indices.Size);
+    PlotMeshEx(label_id, getter, getter_triangles, FitterBox(bounds), flags, nullptr, shaded ? &shading : nullptr);
+}
+
+#define INSTANTIATE_MACRO(T)                                                                                                                         \
+    template IMPLOT3D_API void PlotIsosurface<T>(const char* label_id, const T* volume, int nx, int ny, int nz, double iso,                          \
+                                                 const ImPlot3DBox& bounds, ImPlot3DIsosurfaceFlags flags);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+//-----------------------------------------------------------------------------
+// [SECTION] PlotVoxels
+//-----------------------------------------------------------------------------
+
+// Cells of a voxel chunk along each axis. Chunks are processed with one cell of their neighbors on each side, so each line of cells fits the
+// bits of an ImU64
+#define VOXELS_CHUNK 62
+
+// Other two axes of the faces of each axis, the first along the bits of the face masks
+static const int VOXELS_FACE_AXES[3][2] = {{1, 2}, {0, 2}, {0, 1}};
+
+// Index of the lowest set bit of a nonzero mask
+static inline int LowestBit64(ImU64 v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(v);
+#else
+    static const int debruijn[64] = {0,  1,  48, 2,  57, 49, 28, 3,  61, 58, 50, 42, 38, 29, 17, 4,  62, 55, 59, 36, 53, 51,
+                                     43, 22, 45, 39, 33, 30, 24, 18, 12, 5,  63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21,
+                                     44, 32, 23, 11, 46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9,  13, 8,  7,  6};
+    return debruijn[((v & (~v + 1)) * 0x03F79D71B4CB0A89ull) >> 58];
+#endif
+}
+
+// Reads the occupancy of up to 64 consecutive cells, bit i is set if cell i is occupied
+static inline ImU64 ReadOccupancyBits(const ImU8* cells, int count) {
+    ImU64 bits = 0;
+    int i = 0;
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    // Eight cells at a time: fold the bits of each byte into its lowest bit, then gather the lowest bits of the eight bytes
+    for (; i + 8 <= count; i += 8) {
+        ImU64 word;
+        memcpy(&word, cells + i, sizeof(word));
+        word |= word >> 4;
+        word |= word >> 2;
+        word |= word >> 1;
+        bits |= (((word & 0x0101010101010101ull) * 0x0102040810204080ull) >> 56) << i;
+    }
+#endif
+    for (; i < count; i++)
+        bits |= (ImU64)(cells[i] != 0) << i;
+    return bits;
+}
+
+// Transposes a 64x64 bit matrix in place: bit c of row r moves to bit r of row c
+static void TransposeBits64(ImU64* rows) {
+    ImU64 mask = 0x00000000FFFFFFFFull;
+    for (int j = 32; j != 0; j >>= 1, mask ^= mask << j) {
+        for (int k = 0; k < 64; k = (k + j + 1) & ~j) {
+            const ImU64 t = ((rows[k] >> j) ^ rows[k + j]) & mask;
+            rows[k] ^= t << j;
+            rows[k + j] ^= t;
+        }
+    }
+}
+
+// Chunks extracted by one job of ExtractVoxels()
+struct VoxelsJob {
+    int Chunk0;        // First chunk
+    int Chunk1;        // One past the last chunk
+    int FaceCount[6];  // Number of faces of each direction, counted by the first pass
+    int FaceOffset[6]; // Offset of the faces of each direction of the job in the grid faces
+    ImU64* Columns[3]; // Occupancy of each line of cells of the chunk along each axis, one bit per cell
+    ImU64* Layers;     // Faces of the current direction in each cell layer of the chunk, one bit per face
+};
+
+struct VoxelsJobData {
+    const ImU8* Occupancy;
+    int Size[3];          // Cells of the grid along each axis
+    int ChunkCount[3];    // Chunks of the grid along each axis
+    ImPlot3DPoint Origin; // Position of the first cell corner
+    ImPlot3DPoint Step;   // Size of a cell
+    VoxelsJob* Jobs;
+    int* ChunkFaces;    // Number of faces of each chunk, counted by the first pass
+    ImPlot3DPoint* Vtx; // Output vertices, nullptr in the counting pass
+};
+
+// Extracts the faces of the chunks of a job. Exposed faces are found with bit operations on the lines of cells crossing them, then the faces
+// of each layer are merged greedily: each rectangle is extended along the bits of its row, then over the next rows having all its bits set.
+// The first pass only counts the faces, so the second pass writes them in place without allocating
+static void ExtractVoxelsJob(int index, void* job_data) {
+    const VoxelsJobData& d = *(const VoxelsJobData*)job_data;
+    VoxelsJob& job = d.Jobs[index];
+    const bool write = d.Vtx != nullptr;
+    const int nx = d.Size[0];
+    const int ny = d.Size[1];
+    const int nz = d.Size[2];
+    int face_count[6] = {};
+    for (int chunk = job.Chunk0; chunk < job.Chunk1; chunk++) {
+        int origin[3], size[3];
+        origin[0] = chunk % d.ChunkCount[0] * VOXELS_CHUNK;
+        origin[1] = chunk / d.ChunkCount[0] % d.ChunkCount[1] * VOXELS_CHUNK;
+        origin[2] = chunk / (d.ChunkCount[0] * d.ChunkCount[1]) * VOXELS_CHUNK;
+        for (int a = 0; a < 3; a++)
+            size[a] = ImMin(VOXELS_CHUNK, d.Size[a] - origin[a]);
+
+        // The second pass skips the chunks without faces
+        if (write && d.ChunkFaces[chunk] == 0)
+            continue;
+
+        // Read the cells of the chunk and their neighbors along x (bit p is the cell at origin - 1 + p), then transpose them into the lines
+        // along y and z. Cells outside of the grid are empty
+        ImU64* cols_x = job.Columns[0];
+        ImU64* cols_y = job.Columns[1];
+        ImU64* cols_z = job.Columns[2];
+        memset(cols_x, 0, 64 * 64 * sizeof(ImU64));
+        const int x_begin = ImMax(origin[0] - 1, 0);
+        const int x_end = ImMin(origin[0] + size[0] + 1, nx);
+        ImU64 any = 0;
+        for (int pz = ImMax(1 - origin[2], 0); pz < size[2] + 2 && origin[2] - 1 + pz < nz; pz++) {
+            for (int py = ImMax(1 - origin[1], 0); py < size[1] + 2 && origin[1] - 1 + py < ny; py++) {
+                const ImU8* row = d.Occupancy + ((size_t)(origin[2] - 1 + pz) * ny + (origin[1] - 1 + py)) * nx;
+                cols_x[pz * 64 + py] = ReadOccupancyBits(row + x_begin, x_end - x_begin) << (x_begin - origin[0] + 1);
+                any |= cols_x[pz * 64 + py];
+            }
+        }
+        if (any == 0) {
+            if (!write)
+                d.ChunkFaces[chunk] = 0;
+            continue;
+        }
+        memcpy(cols_y, cols_x, 64 * 64 * sizeof(ImU64));
+        for (int p = 0; p < 64; p++) {
+            TransposeBits64(cols_y + p * 64);
+            for (int pz = 0; pz < 64; pz++)
+                cols_z[p * 64 + pz] = cols_x[pz * 64 + p];
+            TransposeBits64(cols_z + p * 64);
+        }
+        int chunk_faces = 0;
+
+        for (int dir = 0; dir < 6; dir++) {
+            const int a = dir / 2;
+            const int u = VOXELS_FACE_AXES[a][0];
+            const int v = VOXELS_FACE_AXES[a][1];
+            const bool positive = (dir & 1) != 0;
+            const ImU64* cols = job.Columns[a];
+            const ImU64 chunk_mask = (((ImU64)1 << size[a]) - 1) << 1;
+
+            // Faces of the occupied cells whose neighbor along the direction is empty, moved to the layer of their cell
+            ImU64* layers = job.Layers;
+            for (int pv = 1; pv <= size[v]; pv++) {
+                for (int pu = 1; pu <= size[u]; pu++) {
+                    const ImU64 col = cols[pv * 64 + pu];
+                    ImU64 faces = (positive ? col & ~(col >> 1) : col & ~(col << 1)) & chunk_mask;
+                    for (; faces != 0; faces &= faces - 1)
+                        layers[LowestBit64(faces) * 64 + pv] |= (ImU64)1 << pu;
+                }
+            }
+
+            // Merge the faces of each layer into rectangles, clearing the layers for the next direction
+            for (int pa = 1; pa <= size[a]; pa++) {
+                ImU64* rows = layers + pa * 64;
+                for (int pv = 1; pv <= size[v]; pv++) {
+                    while (rows[pv] != 0) {
+                        const int u0 = LowestBit64(rows[pv]);
+                        const int width = LowestBit64(~(rows[pv] >> u0));
+                        const ImU64 mask = (((ImU64)1 << width) - 1) << u0;
+                        rows[pv] &= ~mask;
+                        int height = 1;
+                        while (pv + height <= size[v] && (rows[pv + height] & mask) == mask)
+                            rows[pv + height++] &= ~mask;
+                        if (write) {
+                            // Corners counter-clockwise seen from outside of the cells
+                            ImPlot3DPoint corners[4];
+                            for (int k = 0; k < 4; k++) {
+                                corners[k][a] = (float)(origin[a] - 1 + pa + (positive ? 1 : 0));
+                                corners[k][u] = (float)(origin[u] - 1 + u0 + (k == 1 || k == 2 ? width : 0));
+                                corners[k][v] = (float)(origin[v] - 1 + pv + (k >= 2 ? height : 0));
+                            }
+                            if (positive == (a == 1))
+                                ImSwap(corners[1], corners[3]);
+                            ImPlot3DPoint* out = d.Vtx + (size_t)(job.FaceOffset[dir] + face_count[dir]) * 4;
+                            for (int k = 0; k < 4; k++)
+                                out[k] = d.Origin + corners[k] * d.Step;
+                        }
+                        face_count[dir]++;
+                        chunk_faces++;
+                    }
+                }
+            }
+        }
+        if (!write)
+            d.ChunkFaces[chunk] = chunk_faces;
+    }
+    if (!write)
+        for (int dir = 0; dir < 6; dir++)
+            job.FaceCount[dir] = face_count[dir];
+}
+
+// Extracts the merged faces of a voxel grid, splitting the grid in chunks extracted in parallel. Faces are merged within their chunk
+static void ExtractVoxels(ImPlot3DVoxels& voxels, const ImU8* occupancy, int nx, int ny, int nz, const ImPlot3DBox& bounds) {
+    VoxelsJobData data;
+    data.Occupancy = occupancy;
+    data.Size[0] = nx;
+    data.Size[1] = ny;
+    data.Size[2] = nz;
+    for (int a = 0; a < 3; a++)
+        data.ChunkCount[a] = (data.Size[a] + VOXELS_CHUNK - 1) / VOXELS_CHUNK;
+    data.Origin = bounds.Min;
+    data.Step = (bounds.Max - bounds.Min) / ImPlot3DPoint((float)nx, (float)ny, (float)nz);
+    data.Vtx = nullptr;
+
+    // Each job needs the three occupancy bit planes of its current chunk and the faces of its current direction
+    const int chunk_count = data.ChunkCount[0] * data.ChunkCount[1] * data.ChunkCount[2];
+    const int job_count = ImMin(GetParallelJobCount(), chunk_count);
+    VoxelsJob jobs[IMPLOT3D_MAX_JOBS];
+    ImVector<ImU64> scratch;
+    ImVector<int> chunk_faces;
+    scratch.resize(job_count * 4 * 64 * 64);
+    memset(scratch.Data, 0, scratch.size_in_bytes());
+    chunk_faces.resize(chunk_count);
+    data.ChunkFaces = chunk_faces.Data;
+    for (int i = 0; i < job_count; i++) {
+        jobs[i].Chunk0 = chunk_count * i / job_count;
+        jobs[i].Chunk1 = chunk_count * (i + 1) / job_count;
+        for (int a = 0; a < 3; a++)
+            jobs[i].Columns[a] = scratch.Data + (i * 4 + a) * 64 * 64;
+        jobs[i].Layers = scratch.Data + (i * 4 + 3) * 64 * 64;
+    }
+    data.Jobs = jobs;
+
+    // Count the faces of each job, then write them in place grouped by direction
+    ParallelFor(job_count, ExtractVoxelsJob, &data);
+    int face_total = 0;
+    for (int dir = 0; dir < 6; dir++) {
+        voxels.FaceOffsets[dir] = face_total;
+        for (int i = 0; i < job_count; i++) {
+            jobs[i].FaceOffset[dir] = face_total;
+            face_total += jobs[i].FaceCount[dir];
+        }
+    }
+    voxels.FaceOffsets[6] = face_total;
+    voxels.Vertices.resize(face_total * 4);
+    data.Vtx = voxels.Vertices.Data;
+    if (face_total > 0)
+        ParallelFor(job_count, ExtractVoxelsJob, &data);
+}
+
+void PlotVoxels(const char* label_id, const ImU8* occupancy, int nx, int ny, int nz, const ImPlot3DBox& bounds, ImPlot3DVoxelsFlags flags) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotVoxels() needs to be called between BeginPlot() and EndPlot()!");
+    if (nx < 1 || ny < 1 || nz < 1)
+        return;
+
+    // Each item keeps its own faces, which only depend on the grid and its bounds
+    const ImPlot3DNextItemData& next = gp.NextItemData;
+    const ImGuiID item_id = next.Handle.ID != 0 ? next.Handle.ID : gp.CurrentItems->GetItemID(label_id);
+    const int size[3] = {nx, ny, nz};
+    ImGuiID key = ImHashData(&gp.CurrentPlot->ID, sizeof(ImGuiID));
+    key = ImHashData(&item_id, sizeof(ImGuiID), key);
+    key = ImHashData(&occupancy, sizeof(occupancy), key);
+    key = ImHashData(size, sizeof(size), key);
+    ImPlot3DVoxels& voxels = *gp.Voxels.GetOrAddByKey(key);
+    const bool bounds_changed = !(voxels.Bounds.Min == bounds.Min && voxels.Bounds.Max == bounds.Max);
+    if (voxels.LastFrame == -1 || voxels.DataVersion != next.DataVersion || bounds_changed) {
+        voxels.Key = key;
+        voxels.DataVersion = next.DataVersion;
+        voxels.Bounds = bounds;
+        voxels.Version = NewSourceVersion();
+        ExtractVoxels(voxels, occupancy, nx, ny, nz, bounds);
+    }
+    voxels.LastFrame = ImGui::GetFrameCount();
+
+    // The faces identify the grid and its bounds
+    gp.NextItemData.SourceVersion = voxels.Version;
+    if (BeginItemEx(label_id, FitterBox(bounds), flags, ImPlot3DCol_Fill)) {
+        const ImPlot3DNextItemData& n = GetItemData();
+        const ImPlot3DPlot& plot = *gp.CurrentPlot;
+        const bool render_fill = n.RenderFill && !ImHasFlag(flags, ImPlot3DVoxelsFlags_NoFill);
+        const bool render_lines = n.RenderLine && !n.IsAutoLine && !ImHasFlag(flags, ImPlot3DVoxelsFlags_NoLines);
+        const bool shaded = ImHasFlag(flags, ImPlot3DVoxelsFlags_Shaded);
+        const ImU32 col_fill = ImGui::GetColorU32(n.Colors[ImPlot3DCol_Fill]);
+        const ImU32 col_line = ImGui::GetColorU32(n.Colors[ImPlot3DCol_Line]);
+        for (int dir = 0; dir < 6; dir++) {
+            const int face_count = voxels.FaceOffsets[dir + 1] - voxels.FaceOffsets[dir];
+            if (face_count == 0)
+                continue;
+
+            // The faces of a direction pointing away from the camera are behind the faces of the same cells pointing towards it. The
+            // projection is orthographic, so the test holds for every face of the direction
+            if (!ImHasFlag(flags, ImPlot3DVoxelsFlags_NoCulling)) {
+                const int axis = dir / 2;
+                ImPlot3DPoint normal(0.0f, 0.0f, 0.0f);
+                normal[axis] = ((dir & 1) != 0) != ImHasFlag(plot.Axes[axis].Flags, ImPlot3DAxisFlags_Invert) ? 1.0f : -1.0f;
+                if ((plot.Rotation * normal).z <= 0.0f)
+                    continue;
+            }
+
+            Getter3DPoints getter(voxels.Vertices.Data + voxels.FaceOffsets[dir] * 4, face_count * 4);
+            if (render_fill)
+                RenderPrimitives<RendererQuadFill>(getter, shaded ? ShadeColor(col_fill, ShadeAxis(dir / 2)) : col_fill);
+            if (render_lines)
+                RenderPrimitives<RendererLineSegments>(GetterQuadLines<Getter3DPoints>(getter), col_line, n.LineWeight);
+        }
+        EndItem();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotImage
 //-----------------------------------------------------------------------------
@@ -1463,6 +3698,14 @@ void PlotText(const char* text, float x, float y, float z, float angle, const Im
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotText() needs to be called between BeginPlot() and EndPlot()!");
     SetupLock();
     ImPlot3DPlot& plot = *gp.CurrentPlot;
+    const ImU32 col = GetStyleColorU32(ImPlot3DCol_InlayText);
+
+    // Texts aren't versioned items, so they are hashed with the items to update the plot dirty state
+    const float params[6] = {x, y, z, angle, pix_offset.x, pix_offset.y};
+    ImGuiID hash = ImHashData(text, strlen(text));
+    hash = ImHashData(params, sizeof(params), hash);
+    hash = ImHashData(&col, sizeof(ImU32), hash);
+    plot.ItemsHash = ImHashData(&hash, sizeof(ImGuiID), plot.ItemsHash);
 
     ImPlot3DBox cull_box;
     if (ImHasFlag(plot.Flags, ImPlot3DFlags_NoClip)) {
@@ -1478,9 +3721,215 @@ void PlotText(const char* text, float x, float y, float z, float angle, const Im
     ImVec2 p = PlotToPixels(ImPlot3DPoint(x, y, z));
     p.x += pix_offset.x;
     p.y += pix_offset.y;
-    AddTextRotated(GetPlotDrawList(), p, angle, GetStyleColorU32(ImPlot3DCol_InlayText), text);
+    AddTextRotated(GetPlotDrawList(), p, angle, col, text);
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] SubmitCommandList
+//-----------------------------------------------------------------------------
+
+void SubmitCommandList(const ImPlot3DCommandList& list) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "SubmitCommandList() needs to be called between BeginPlot() and EndPlot()!");
+    for (const ImPlot3DCommandList::Command& cmd : list.Commands) {
+        SetNextLineStyle(cmd.LineColor, cmd.LineWeight);
+        SetNextFillStyle(cmd.FillColor, cmd.FillAlpha);
+        SetNextMarkerStyle(cmd.Marker, cmd.MarkerSize, cmd.MarkerFill, cmd.MarkerWeight, cmd.MarkerOutline);
+        gp.NextItemData.SourceVersion = list.Version;
+        const char* label_id = list.Labels.Data + cmd.LabelOffset;
+        Getter3DPoints getter(list.Points.Data + cmd.PointOffset, cmd.PointCount);
+        FitterBox fitter(cmd.Bounds);
+        switch (cmd.Type) {
+            case ImPlot3DCommandList::CommandType_Scatter: PlotScatterFade(label_id, getter, fitter, cmd.Flags); break;
+            case ImPlot3DCommandList::CommandType_Line: PlotLineFade(label_id, getter, fitter, cmd.Flags); break;
+            case ImPlot3DCommandList::CommandType_Triangle: PlotTriangleEx(label_id, getter, fitter, cmd.Flags); break;
+            case ImPlot3DCommandList::CommandType_Quad: PlotQuadEx(label_id, getter, fitter, cmd.Flags); break;
+            case ImPlot3DCommandList::CommandType_Surface:
+                PlotSurfaceEx(label_id, getter, fitter, cmd.XCount, cmd.YCount, cmd.ScaleMin, cmd.ScaleMax, cmd.Flags);
+                break;
+            case ImPlot3DCommandList::CommandType_Mesh: {
+                Getter3DPoints getter_triangles(list.Points.Data + cmd.PointOffset + cmd.PointCount, cmd.TriangleCount * 3);
+                PlotMeshEx(label_id, getter, getter_triangles, fitter, cmd.Flags);
+                break;
+            }
+        }
+    }
 }
 
 } // namespace ImPlot3D
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DCommandList
+//-----------------------------------------------------------------------------
+
+ImPlot3DCommandList::ImPlot3DCommandList() {
+    Version = ImPlot3D::NewSourceVersion();
+    _ResetNextStyle();
+}
+
+void ImPlot3DCommandList::Clear() {
+    Commands.shrink(0);
+    Points.shrink(0);
+    Labels.shrink(0);
+    Version = ImPlot3D::NewSourceVersion();
+    _ResetNextStyle();
+}
+
+void ImPlot3DCommandList::SetNextLineStyle(const ImVec4& col, float weight) {
+    _NextStyle.LineColor = col;
+    _NextStyle.LineWeight = weight;
+}
+
+void ImPlot3DCommandList::SetNextFillStyle(const ImVec4& col, float alpha_mod) {
+    _NextStyle.FillColor = col;
+    _NextStyle.FillAlpha = alpha_mod;
+}
+
+void ImPlot3DCommandList::SetNextMarkerStyle(ImPlot3DMarker marker, float size, const ImVec4& fill, float weight, const ImVec4& outline) {
+    _NextStyle.Marker = marker;
+    _NextStyle.MarkerSize = size;
+    _NextStyle.MarkerFill = fill;
+    _NextStyle.MarkerWeight = weight;
+    _NextStyle.MarkerOutline = outline;
+}
+
+void ImPlot3DCommandList::_ResetNextStyle() {
+    _NextStyle.LineColor = _NextStyle.FillColor = _NextStyle.MarkerFill = _NextStyle.MarkerOutline = IMPLOT3D_AUTO_COL;
+    _NextStyle.LineWeight = _NextStyle.FillAlpha = _NextStyle.MarkerSize = _NextStyle.MarkerWeight = IMPLOT3D_AUTO;
+    _NextStyle.Marker = IMPLOT3D_AUTO;
+}
+
+ImPlot3DCommandList::Command& ImPlot3DCommandList::_AddCommand(CommandType type, const char* label_id, int flags) {
+    Command cmd = _NextStyle;
+    _ResetNextStyle();
+    cmd.Type = type;
+    cmd.Flags = flags;
+    // Keep the null terminator of each label
+    cmd.LabelOffset = Labels.Size;
+    Labels.append(label_id, (int)strlen(label_id) + 1);
+    cmd.PointOffset = Points.Size;
+    cmd.PointCount = 0;
+    cmd.TriangleCount = 0;
+    cmd.XCount = cmd.YCount = 0;
+    cmd.ScaleMin = cmd.ScaleMax = 0.0;
+    cmd.Bounds = ImPlot3D::ImEmptyBox();
+    Commands.push_back(cmd);
+    Version = ImPlot3D::NewSourceVersion();
+    return Commands.back();
+}
+
+// Converts the points of a getter to plot coordinates and computes their bounds
+template <typename _Getter> static void RecordPoints(ImPlot3DCommandList& list, ImPlot3DCommandList::Command& cmd, const _Getter& getter) {
+    list.Points.resize(cmd.PointOffset + getter.Count);
+    ImPlot3DPoint* points = list.Points.Data + cmd.PointOffset;
+    for (int i = 0; i < getter.Count; i++) {
+        points[i] = getter(i);
+        ImPlot3D::ImExpandBox(cmd.Bounds, points[i]);
+    }
+    cmd.PointCount = getter.Count;
+}
+
+template <typename T>
+static void RecordXYZ(ImPlot3DCommandList& list, ImPlot3DCommandList::CommandType type, const char* label_id, const T* xs, const T* ys, const T* zs,
+                      int count, int flags, int offset, int stride) {
+    using namespace ImPlot3D;
+    ImPlot3DCommandList::Command& cmd = list._AddCommand(type, label_id, flags);
+    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, offset, stride), IndexerIdx<T>(ys, count, offset, stride),
+                                                                  IndexerIdx<T>(zs, count, offset, stride), count);
+    RecordPoints(list, cmd, getter);
+}
+
+template <typename T>
+void ImPlot3DCommandList::PlotScatter(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DScatterFlags flags, int offset,
+                                      int stride) {
+    if (count < 1)
+        return;
+    RecordXYZ(*this, CommandType_Scatter, label_id, xs, ys, zs, count, flags, offset, stride);
+}
+
+template <typename T>
+void ImPlot3DCommandList::PlotLine(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DLineFlags flags, int offset,
+                                   int stride) {
+    if (count < 2)
+        return;
+    RecordXYZ(*this, CommandType_Line, label_id, xs, ys, zs, count, flags, offset, stride);
+}
+
+template <typename T>
+void ImPlot3DCommandList::PlotTriangle(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DTriangleFlags flags,
+                                       int offset, int stride) {
+    if (count < 3)
+        return;
+    RecordXYZ(*this, CommandType_Triangle, label_id, xs, ys, zs, count, flags, offset, stride);
+}
+
+template <typename T>
+void ImPlot3DCommandList::PlotQuad(const char* label_id, const T* xs, const T* ys, const T* zs, int count, ImPlot3DQuadFlags flags, int offset,
+                                   int stride) {
+    if (count < 3)
+        return;
+    RecordXYZ(*this, CommandType_Quad, label_id, xs, ys, zs, count, flags, offset, stride);
+}
+
+template <typename T>
+void ImPlot3DCommandList::PlotSurface(const char* label_id, const T* xs, const T* ys, const T* zs, int x_count, int y_count, double scale_min,
+                                      double scale_max, ImPlot3DSurfaceFlags flags, int offset, int stride) {
+    int count = x_count * y_count;
+    if (count < 4)
+        return;
+    RecordXYZ(*this, CommandType_Surface, label_id, xs, ys, zs, count, flags, offset, stride);
+    Command& cmd = Commands.back();
+    cmd.XCount = x_count;
+    cmd.YCount = y_count;
+    cmd.ScaleMin = scale_min;
+    cmd.ScaleMax = scale_max;
+}
+
+template <typename T>
+void ImPlot3DCommandList::PlotSurface(const char* label_id, const T* zs, int x_count, int y_count, double x_min, double x_max, double y_min,
+                                      double y_max, double scale_min, double scale_max, ImPlot3DSurfaceFlags flags, int offset, int stride) {
+    using namespace ImPlot3D;
+    int count = x_count * y_count;
+    if (count < 4)
+        return;
+    Command& cmd = _AddCommand(CommandType_Surface, label_id, flags);
+    RecordPoints(*this, cmd, GetterGridZ<IndexerIdx<T>>(IndexerIdx<T>(zs, count, offset, stride), x_count, y_count, x_min, x_max, y_min, y_max));
+    cmd.XCount = x_count;
+    cmd.YCount = y_count;
+    cmd.ScaleMin = scale_min;
+    cmd.ScaleMax = scale_max;
+}
+
+#define INSTANTIATE_MACRO(T)                                                                                                                         \
+    template IMPLOT3D_API void ImPlot3DCommandList::PlotScatter<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count,           \
+                                                                   ImPlot3DScatterFlags flags, int offset, int stride);                              \
+    template IMPLOT3D_API void ImPlot3DCommandList::PlotLine<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count,              \
+                                                                ImPlot3DLineFlags flags, int offset, int stride);                                    \
+    template IMPLOT3D_API void ImPlot3DCommandList::PlotTriangle<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count,          \
+                                                                    ImPlot3DTriangleFlags flags, int offset, int stride);                            \
+    template IMPLOT3D_API void ImPlot3DCommandList::PlotQuad<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count,              \
+                                                                ImPlot3DQuadFlags flags, int offset, int stride);                                    \
+    template IMPLOT3D_API void ImPlot3DCommandList::PlotSurface<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int x_count,         \
+                                                                   int y_count, double scale_min, double scale_max, ImPlot3DSurfaceFlags flags,      \
+                                                                   int offset, int stride);                                                          \
+    template IMPLOT3D_API void ImPlot3DCommandList::PlotSurface<T>(const char* label_id, const T* zs, int x_count, int y_count, double x_min,        \
+                                                                   double x_max, double y_min, double y_max, double scale_min, double scale_max,     \
+                                                                   ImPlot3DSurfaceFlags flags, int offset, int stride);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+void ImPlot3DCommandList::PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count,
+                                   ImPlot3DMeshFlags flags) {
+    Command& cmd = _AddCommand(CommandType_Mesh, label_id, flags);
+    RecordPoints(*this, cmd, ImPlot3D::Getter3DPoints(vtx, vtx_count));
+
+    // Expand the indexed triangles, so no index is followed when rendering
+    const int tri_count = idx_count / 3;
+    Points.resize(cmd.PointOffset + vtx_count + tri_count * 3);
+    ImPlot3DPoint* tri_points = Points.Data + cmd.PointOffset + vtx_count;
+    for (int i = 0; i < tri_count * 3; i++)
+        tri_points[i] = vtx[idx[i]];
+    cmd.TriangleCount = tri_count;
+}
+
 #endif // #ifndef IMGUI_DISABLE